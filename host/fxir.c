@@ -0,0 +1,69 @@
+/*
+ * Impulse response of the reverb, for listening and for checking the
+ * decay time offline: fxir out.wav [rt60]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "synth.h"
+#include "fx.h"
+#include "wav.h"
+
+#define SECONDS 4
+#define FRAMES (SECONDS * SYNTH_SAMPLERATE)
+
+static float energy[FRAMES];
+
+int main(int argc, char *argv[]) {
+	if (argc != 2 && argc != 3) {
+		fprintf(stderr, "usage: %s out.wav [rt60]\n", argv[0]);
+		return 1;
+	}
+	FILE *out = wav_open(argv[1], SYNTH_SAMPLERATE, 2);
+	if (!out) {
+		perror(argv[1]);
+		return 1;
+	}
+
+	fx_init(SYNTH_SAMPLERATE);
+	fx_reverb_wet(1);
+	if (argc == 3)
+		fx_reverb_time(atof(argv[2]));
+
+	for (int f = 0; f < FRAMES; f += SYNTH_BLOCK) {
+		float in[SYNTH_BLOCK] = { 0 }, l[SYNTH_BLOCK] = { 0 }, r[SYNTH_BLOCK] = { 0 };
+		int16_t buf[2 * SYNTH_BLOCK];
+		if (f == 0)
+			in[0] = 1;
+		fx_reverb(in, in, l, r, SYNTH_BLOCK);
+		for (int i = 0; i < SYNTH_BLOCK; i++) {
+			energy[f + i] = l[i] * l[i] + r[i] * r[i];
+			buf[2*i] = 0x7fff * l[i];
+			buf[2*i+1] = 0x7fff * r[i];
+		}
+		wav_write(out, buf, 2 * SYNTH_BLOCK);
+	}
+	wav_close(out);
+
+	// schroeder backward integration, rt60 from the -5..-35 dB slope
+	double sum = 0, total;
+	for (int i = FRAMES - 1; i >= 0; i--) {
+		sum += energy[i];
+		energy[i] = sum;
+	}
+	total = sum;
+	int t5 = -1, t35 = -1;
+	for (int i = 0; i < FRAMES; i++) {
+		double db = 10 * log10(energy[i] / total);
+		if (t5 < 0 && db < -5)
+			t5 = i;
+		if (t35 < 0 && db < -35)
+			t35 = i;
+	}
+	if (t5 < 0 || t35 < 0) {
+		printf("%s: decay did not reach -35 dB in %d s\n", argv[1], SECONDS);
+		return 1;
+	}
+	printf("%s: rt60 %.2f s\n", argv[1], 2.0 * (t35 - t5) / SYNTH_SAMPLERATE);
+	return 0;
+}
@@ -0,0 +1,262 @@
+/*
+ * Golden output regression test for the synth engine: every instrument
+ * plays the same short event script through synth_render() and the output
+ * is compared with a stored reference render, within a tolerance so that
+ * reordered float math, fixed point or SIMD paths can pass. On top of that
+ * a held note on the instrument's own bus, with the sends off, is
+ * measured for dc and aliasing; neither may rise above the stored figures.
+ *
+ *   regress golden         compare against golden/
+ *   regress -u golden      write new references after an intended change
+ *
+ * Includes synth.c itself for the buses and the patches.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "synth.c"
+
+#define RATE SYNTH_SAMPLERATE
+#define SEED 0x12345678
+
+#define TOLERANCE_DB -60 // difference energy to reference energy
+#define MARGIN_DB 3 // allowed rise of dc and aliasing over the stored figures
+#define FLOOR_DB -70 // below which they always pass
+#define HELD_NOTE 96 // C7, 2093 Hz, or a sample's root key
+
+enum { EV_ON, EV_OFF, EV_CTRL, EV_BEND, EV_END };
+
+typedef struct {
+	float time; // seconds
+	int type;
+	int arg; // note or control
+	float value; // velocity, control value or semitones
+} Event;
+
+/*
+ * Played by every instrument: a low note and a hat for the drum kit, a
+ * high note on top, the pots moved, a bend and the release.
+ */
+static const Event script[] = {
+	{ 0.00, EV_ON, 36, 0.9 },
+	{ 0.00, EV_ON, 42, 0.6 },
+	{ 0.10, EV_ON, 84, 0.8 },
+	{ 0.15, EV_CTRL, SYNTH_CTRL_POT0, 1.0 },
+	{ 0.15, EV_CTRL, SYNTH_CTRL_POT0 + 1, 0.2 },
+	{ 0.20, EV_BEND, 0, 2 },
+	{ 0.25, EV_OFF, 36, 0 },
+	{ 0.25, EV_OFF, 42, 0 },
+	{ 0.25, EV_OFF, 84, 0 },
+	{ 0, EV_END, 0, 0 },
+};
+
+#define SCRIPT_FRAMES (RATE / 5 * 2) // 0.4 s
+#define HELD_FRAMES RATE // analysed, after a quarter second to settle
+
+static int16_t out[2 * SCRIPT_FRAMES], ref[2 * SCRIPT_FRAMES];
+static float held[HELD_FRAMES];
+
+static void restart(void) {
+	synth_seed(SEED);
+	synth_init(RATE);
+}
+
+static void play(int instr) {
+	const Event *e = script;
+	int frame = 0;
+	restart();
+	while (frame < SCRIPT_FRAMES) {
+		for (; e->type != EV_END && e->time * RATE <= frame; e++) {
+			switch (e->type) {
+			case EV_ON: synth_note_on(e->arg, instr, e->value); break;
+			case EV_OFF: synth_note_off(e->arg, instr); break;
+			case EV_CTRL: synth_setcontrol(e->arg, e->value); break;
+			case EV_BEND: synth_pitchbend(instr, e->value); break;
+			}
+		}
+		int n = SCRIPT_FRAMES - frame < SYNTH_BLOCK ? SCRIPT_FRAMES - frame : SYNTH_BLOCK;
+		synth_render(out + 2 * frame, n);
+		frame += n;
+	}
+}
+
+static double db(double x) {
+	return 10 * log10(x + 1e-30);
+}
+
+// Difference to the reference in dB, -inf-ish when identical.
+static double compare(const char *fname, double *refdb) {
+	FILE *f = fopen(fname, "rb");
+	if (!f)
+		return INFINITY;
+	size_t got = fread(ref, sizeof(*ref), 2 * SCRIPT_FRAMES, f);
+	fclose(f);
+	if (got != 2 * SCRIPT_FRAMES)
+		return INFINITY;
+	double diff = 0, energy = 0;
+	for (int i = 0; i < 2 * SCRIPT_FRAMES; i++) {
+		double d = out[i] - ref[i];
+		diff += d * d;
+		energy += (double)ref[i] * ref[i];
+	}
+	*refdb = db(energy / (2 * SCRIPT_FRAMES)) - db(32768.0 * 32768);
+	return energy > 0 ? db(diff) - db(energy) : db(diff);
+}
+
+// The note hold() plays: one that sounds, for a sample player.
+static int held_note(int instr) {
+	Instrument *ins = instruments[instr];
+	return ins->numzones ? ins->zones[0].root : HELD_NOTE;
+}
+
+/*
+ * Hold the note on the instrument's bus alone, no sends, no spread and
+ * the unison lanes in tune so that everything falls on the harmonics,
+ * with any filter open. One shots are caught from the start.
+ */
+static void hold(int instr) {
+	Instrument *ins = instruments[instr];
+	BusParams saved = ins->bus;
+	float spread = ins->spread, detune = ins->detune;
+	int16_t tmp[2 * SYNTH_BLOCK];
+
+	restart();
+	for (int k = 0; k < FX_NUM_SENDS; k++)
+		ins->bus.send[k] = 0;
+	ins->spread = 0;
+	ins->detune = 0;
+	synth_setcontrol(SYNTH_CTRL_POT0, 0); // no vibrato, narrowest pulse
+	synth_setcontrol(SYNTH_CTRL_POT0 + 1, 1); // filters open
+	synth_note_on(held_note(instr), instr, 1.0);
+	for (int i = 0; i < (ins->numzones ? 0 : RATE / 4); i += SYNTH_BLOCK)
+		synth_render(tmp, SYNTH_BLOCK);
+	for (int i = 0; i < HELD_FRAMES; i += SYNTH_BLOCK) {
+		synth_render(tmp, SYNTH_BLOCK);
+		memcpy(held + i, buses[instr].l, SYNTH_BLOCK * sizeof(*held));
+	}
+	ins->bus = saved;
+	ins->spread = spread;
+	ins->detune = detune;
+}
+
+// The mean of the held note, dB relative to full scale.
+static double dc(void) {
+	double mean = 0;
+	for (int i = 0; i < HELD_FRAMES; i++)
+		mean += held[i];
+	return 20 * log10(fabs(mean / HELD_FRAMES) + 1e-10);
+}
+
+/*
+ * Power of the held note away from its harmonics, in dB of the total, with
+ * a blackman-harris window so the harmonics' skirts stay within +-6 Hz.
+ * NAN when the instrument is silent or unpitched there.
+ */
+static double alias(int note) {
+	static double x[HELD_FRAMES];
+	double mean = 0, total = 0, harm = 0;
+	for (int i = 0; i < HELD_FRAMES; i++)
+		mean += held[i];
+	mean /= HELD_FRAMES;
+	for (int i = 0; i < HELD_FRAMES; i++) {
+		double t = 2 * PI * i / HELD_FRAMES;
+		double w = 0.35875 - 0.48829 * cos(t) + 0.14128 * cos(2 * t) - 0.01168 * cos(3 * t);
+		x[i] = (held[i] - mean) * w;
+		total += x[i] * x[i];
+	}
+	if (total < 1e-9)
+		return NAN;
+	double f0 = 440 * pow(2, (note - 69) / 12.0);
+	for (int k = 1; k * f0 < RATE / 2; k++) {
+		for (int d = -6; d <= 6; d++) {
+			double re = 0, im = 0, step = 2 * PI * (k * f0 + d) / RATE;
+			for (int i = 0; i < HELD_FRAMES; i++) {
+				re += x[i] * cos(step * i);
+				im += x[i] * sin(step * i);
+			}
+			harm += 2 * (re * re + im * im) / HELD_FRAMES;
+		}
+	}
+	if (harm < total / 2)
+		return NAN;
+	return db(fmax(total - harm, 0)) - db(total);
+}
+
+/*
+ * Within the margin of the stored figure. NAN, nothing to measure, only
+ * passes where nothing was measured before either.
+ */
+static int figure_ok(double value, double stored) {
+	if (isnan(value))
+		return isnan(stored);
+	return value <= FLOOR_DB || value <= stored + MARGIN_DB;
+}
+
+int main(int argc, char *argv[]) {
+	int update = argc == 3 && strcmp(argv[1], "-u") == 0;
+	if (argc != 2 + update) {
+		fprintf(stderr, "usage: %s [-u] golden_dir\n", argv[0]);
+		return 1;
+	}
+	const char *dir = argv[1 + update];
+	char fname[256];
+	double refdc[NUM_INSTRUMENTS], refalias[NUM_INSTRUMENTS];
+	FILE *sf;
+	int failed = 0;
+
+	// spectra.txt: instrument, dc dBFS, aliasing dB
+	snprintf(fname, sizeof(fname), "%s/spectra.txt", dir);
+	for (int i = 0; i < NUM_INSTRUMENTS; i++)
+		refdc[i] = refalias[i] = -INFINITY;
+	if (!update && (sf = fopen(fname, "r"))) {
+		int i;
+		char d[32], a[32];
+		while (fscanf(sf, "%d %31s %31s", &i, d, a) == 3) {
+			if (i >= 0 && i < NUM_INSTRUMENTS) {
+				refdc[i] = strtod(d, NULL);
+				refalias[i] = strtod(a, NULL);
+			}
+		}
+		fclose(sf);
+	}
+	if (update && !(sf = fopen(fname, "w"))) {
+		perror(fname);
+		return 1;
+	}
+
+	for (int i = 0; i < NUM_INSTRUMENTS; i++) {
+		snprintf(fname, sizeof(fname), "%s/instr%d.raw", dir, i);
+		play(i);
+		hold(i);
+		double dcdb = dc(), al = alias(held_note(i));
+		printf("instr %d: dc %.1f dBFS, alias %.1f dB", i, dcdb, al);
+		if (update) {
+			FILE *f = fopen(fname, "wb");
+			if (!f || fwrite(out, sizeof(out), 1, f) != 1) {
+				perror(fname);
+				return 1;
+			}
+			fclose(f);
+			fprintf(sf, "%d %.1f %.1f\n", i, dcdb, al);
+			printf(", written\n");
+			continue;
+		}
+		double level = 0, diff = compare(fname, &level);
+		if (diff == INFINITY)
+			printf(", no reference");
+		else
+			printf(" (%.1f, %.1f), level %.0f dBFS, difference %.0f dB",
+					refdc[i], refalias[i], level, diff);
+		int ok = diff <= TOLERANCE_DB && figure_ok(dcdb, refdc[i]) &&
+				figure_ok(al, refalias[i]);
+		printf(ok ? ", ok\n" : ", FAIL\n");
+		failed += !ok;
+	}
+	if (update) {
+		fclose(sf);
+		return 0;
+	}
+	printf("%d of %d instruments failed\n", failed, NUM_INSTRUMENTS);
+	return failed != 0;
+}
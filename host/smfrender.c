@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "synth.h"
+#include "smf.h"
+#include "fx.h"
+#include "wav.h"
+
+// Render a midi file through the synth engine exactly like the firmware's
+// fillbuf() does, for checking the smf player and the sound on a pc.
+// usage: smfrender [-r samplerate] song.mid out.wav
+
+#define TAIL_SECONDS 2
+
+static uint8_t *readfile(const char *fname, uint32_t *len) {
+	FILE *f = fopen(fname, "rb");
+	if (!f)
+		return NULL;
+	fseek(f, 0, SEEK_END);
+	*len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8_t *data = malloc(*len);
+	if (fread(data, 1, *len, f) != *len) {
+		free(data);
+		data = NULL;
+	}
+	fclose(f);
+	return data;
+}
+
+static void render(FILE *out, int n) {
+	int16_t buf[2 * SYNTH_BLOCK];
+	synth_render(buf, n);
+	wav_write(out, buf, 2 * n);
+}
+
+int main(int argc, char *argv[]) {
+	int rate = SYNTH_SAMPLERATE;
+	if (argc == 5 && strcmp(argv[1], "-r") == 0) {
+		rate = atoi(argv[2]);
+		argc -= 2;
+		argv += 2;
+	}
+	if (argc != 3 || rate < 8000 || rate > 96000) {
+		fprintf(stderr, "usage: %s [-r samplerate] song.mid out.wav\n", argv[0]);
+		return 1;
+	}
+	uint32_t len;
+	uint8_t *data = readfile(argv[1], &len);
+	if (!data) {
+		perror(argv[1]);
+		return 1;
+	}
+	struct smfplayer song;
+	if (smf_open(&song, data, len, rate)) {
+		fprintf(stderr, "%s: not a supported midi file\n", argv[1]);
+		return 1;
+	}
+	FILE *out = wav_open(argv[2], rate, 2);
+	if (!out) {
+		perror(argv[2]);
+		return 1;
+	}
+
+	synth_init(rate);
+	long frames = 0;
+	while (smf_play(&song, SYNTH_BLOCK)) {
+		fx_delay_tempo(60e6 / song.tempo, FX_DELAY_BEATS);
+		render(out, SYNTH_BLOCK);
+		frames += SYNTH_BLOCK;
+	}
+	for (int i = 0; i < TAIL_SECONDS * rate / SYNTH_BLOCK; i++)
+		render(out, SYNTH_BLOCK);
+	wav_close(out);
+
+	printf("%s: %d tracks, %.1f s\n", argv[1], song.ntracks,
+			(double)frames / rate);
+	free(data);
+	return 0;
+}
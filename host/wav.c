@@ -0,0 +1,51 @@
+#include "wav.h"
+
+static void put16(FILE *f, uint32_t v) {
+	fputc(v & 0xff, f);
+	fputc((v >> 8) & 0xff, f);
+}
+
+static void put32(FILE *f, uint32_t v) {
+	put16(f, v & 0xffff);
+	put16(f, v >> 16);
+}
+
+static void header(FILE *f, int rate, int nchannels, uint32_t datalen) {
+	fwrite("RIFF", 4, 1, f);
+	put32(f, 36 + datalen);
+	fwrite("WAVEfmt ", 8, 1, f);
+	put32(f, 16);
+	put16(f, 1); // pcm
+	put16(f, nchannels);
+	put32(f, rate);
+	put32(f, rate * nchannels * 2);
+	put16(f, nchannels * 2);
+	put16(f, 16);
+	fwrite("data", 4, 1, f);
+	put32(f, datalen);
+}
+
+// sizes are patched in wav_close, the rate and channels stay here
+static int wavrate, wavchans;
+
+FILE *wav_open(const char *fname, int rate, int nchannels) {
+	FILE *f = fopen(fname, "wb");
+	if (!f)
+		return NULL;
+	wavrate = rate;
+	wavchans = nchannels;
+	header(f, rate, nchannels, 0);
+	return f;
+}
+
+void wav_write(FILE *f, const int16_t *samples, int n) {
+	for (int i = 0; i < n; i++)
+		put16(f, (uint16_t)samples[i]);
+}
+
+void wav_close(FILE *f) {
+	long len = ftell(f) - 44;
+	fseek(f, 0, SEEK_SET);
+	header(f, wavrate, wavchans, len);
+	fclose(f);
+}
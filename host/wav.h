@@ -0,0 +1,13 @@
+#ifndef WAV_H
+#define WAV_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Minimal 16-bit pcm wav writer for offline renders.
+
+FILE *wav_open(const char *fname, int rate, int nchannels);
+void wav_write(FILE *f, const int16_t *samples, int n);
+void wav_close(FILE *f);
+
+#endif
@@ -44,4 +44,7 @@ void StopAudio();
 void ProvideAudioBuffer(void *samples,int numsamples);
 bool ProvideAudioBufferWithoutBlocking(void *samples,int numsamples);
 
+// Number of times the DMA finished a buffer with no next one provided.
+int GetAudioUnderruns();
+
 #endif
@@ -0,0 +1,12 @@
+#ifndef ACCEL_H
+#define ACCEL_H
+
+// The LIS302DL is read by SPI DMA whenever its data ready interrupt fires
+// (ACCEL_RATE), and each axis is low passed with a dead zone around zero.
+
+#define ACCEL_RATE 100
+
+int accelinit(void);
+float accel_tilt(int axis); // g, 0 = x, 1 = y, 2 = z
+
+#endif
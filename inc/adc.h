@@ -1,8 +1,19 @@
 #ifndef ADC_H
-#define ADH_H
+#define ADC_H
+
+#include <stdint.h>
+
+// Control inputs are scanned by ADC1 at ADC_SCANRATE, triggered by TIM2,
+// and DMA'd to a buffer. Each block of ADC_OVERSAMPLE scans is summed into
+// a 16-bit value per input (12 bits + 4 bits from oversampling), so full
+// scale is ADC_OVERSAMPLE times the 12-bit maximum.
+
+#define ADC_SCANRATE 4000
+#define ADC_OVERSAMPLE 16
+#define ADC_MAXVALUE (ADC_OVERSAMPLE * 4095)
 
 void adc_init(void);
-int adc_read1(void);
-int adc_read2(void);
+int adc_num_inputs(void);
+uint16_t adc_read(int input);
 
 #endif
@@ -0,0 +1,23 @@
+#ifndef CYCLES_H
+#define CYCLES_H
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+// DWT cycle counter for timing code; this CMSIS version has no DWT struct.
+
+#define DWT_CTRL (*(volatile uint32_t *)0xe0001000)
+#define DWT_CYCCNT (*(volatile uint32_t *)0xe0001004)
+#define DWT_CTRL_CYCCNTENA 1
+
+static inline void cycles_init(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT_CYCCNT = 0;
+	DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+static inline uint32_t cycles(void) {
+	return DWT_CYCCNT;
+}
+
+#endif
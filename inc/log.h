@@ -0,0 +1,19 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+
+// Non-blocking log output on the uart. Text goes out as is; binary records
+// are framed as (0x80 | type), payload length, payload. Text is 7-bit
+// ascii so logcat.py can tell them apart. Records don't need formatting
+// and are safe to send from interrupts.
+
+#define LOG_REC_PING 1 // uint32 tick, uint32 dropped writes
+#define LOG_REC_TELEMETRY 3 // struct telemetry
+
+#define LOG_RECORD_MAX 64
+
+void log_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void log_record(int type, const void *payload, int len);
+
+#endif
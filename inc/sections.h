@@ -0,0 +1,30 @@
+#ifndef SECTIONS_H
+#define SECTIONS_H
+
+// Placement of hot state and code, see stm32_flash.ld and the startup code.
+//
+// CCM is the 64 KB core coupled ram at 0x10000000: zero wait states on the
+// data bus, and no DMA can reach it, so voice state there never waits for
+// the audio or uart streams. For the same reason it can't hold anything a
+// DMA reads or writes, and no code.
+//
+// CCM_BSS is zeroed and CCM_DATA copied from flash at reset. RAMFUNC puts
+// code in main sram instead of flash when built with RAMFUNC=1. NOCCM=1
+// keeps everything in the default sections for comparison. All of these
+// are empty on the host.
+
+#if defined(__arm__) && !defined(SYNTH_NOCCM)
+#define CCM_BSS __attribute__((section(".ccmbss")))
+#define CCM_DATA __attribute__((section(".ccmdata")))
+#else
+#define CCM_BSS
+#define CCM_DATA
+#endif
+
+#if defined(__arm__) && defined(SYNTH_RAMFUNC)
+#define RAMFUNC __attribute__((section(".ramfunc"), long_call))
+#else
+#define RAMFUNC
+#endif
+
+#endif
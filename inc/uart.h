@@ -0,0 +1,22 @@
+#ifndef UART_H
+#define UART_H
+
+#include <stdint.h>
+
+// USART2 on PD5:PD6. Received bytes go to a ring buffer by circular DMA;
+// the line idle interrupt fires once per burst and only counts them.
+// Transmitted bytes are queued to another ring drained by TX DMA, so
+// writers never wait for the line. uart_write is safe from any context.
+
+#define UART_RXBUFSIZE 512 // power of two
+#define UART_TXBUFSIZE 2048 // power of two
+
+void uart_init(int baudrate);
+int uart_getc(void);
+int uart_rxpending(void);
+int uart_write(const void *data, int len);
+
+extern volatile uint32_t uart_rxbursts;
+extern volatile uint32_t uart_txdrops;
+
+#endif
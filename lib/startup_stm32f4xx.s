@@ -93,6 +93,39 @@ LoopFillZerobss:
   cmp  r2, r3
   bcc  FillZerobss
 
+/* Copy the CCM data and RAM functions, zero the CCM bss */
+  ldr  r0, =_sccmdata
+  ldr  r1, =_eccmdata
+  ldr  r2, =_siccmdata
+  b  LoopCopyCcm
+CopyCcm:
+  ldr  r3, [r2], #4
+  str  r3, [r0], #4
+LoopCopyCcm:
+  cmp  r0, r1
+  bcc  CopyCcm
+
+  ldr  r0, =_sramfunc
+  ldr  r1, =_eramfunc
+  ldr  r2, =_siramfunc
+  b  LoopCopyRamfunc
+CopyRamfunc:
+  ldr  r3, [r2], #4
+  str  r3, [r0], #4
+LoopCopyRamfunc:
+  cmp  r0, r1
+  bcc  CopyRamfunc
+
+  ldr  r0, =_sccmbss
+  ldr  r1, =_eccmbss
+  movs  r3, #0
+  b  LoopFillZeroCcm
+FillZeroCcm:
+  str  r3, [r0], #4
+LoopFillZeroCcm:
+  cmp  r0, r1
+  bcc  FillZeroCcm
+
 /* Call the clock system intitialization function.*/
   bl  SystemInit
 /* Call static constructors */
@@ -0,0 +1,78 @@
+#!/usr/bin/python
+# Show the synth's uart log: text passes through, binary records (see
+# inc/log.h) are decoded to lines.
+# usage: logcat.py [/dev/ttyUSB0 [baud]]
+import json, os, serial, struct, sys
+
+BAUDRATE = 115200 # MIDI_BAUDRATE in src/main.c
+
+REC_PING = 1
+REC_TELEMETRY = 3
+
+NUM_CHANNELS = 16
+PATCHES = os.path.join(os.path.dirname(os.path.abspath(__file__)), "src", "patches.json")
+INSTRUMENTS = [p["name"] for p in json.load(open(PATCHES))]
+ADSR_MODES = { 0: "A", 1: "D", 2: "R", 3: "K" }
+
+def ping(payload):
+	tik, drops = struct.unpack("<II", payload)
+	line = "ping %d (%d dropped writes)" % (tik, drops)
+	if tik == 0:
+		line = "******** RESTART *********\r\n" + line
+	return line
+
+def voices(payload):
+	"""synth_dump() bytes to (channel, instrument, note, adsr mode, level 0..1) for live channels"""
+	out = []
+	for ch in range(len(payload) // 3):
+		note, insmode, level = payload[3*ch:3*ch+3]
+		if not note & 0x80:
+			out.append((ch, insmode >> 2, note, insmode & 3, level / 255.0))
+	return out
+
+def parse_telemetry(payload):
+	fields = struct.unpack("<HHHHH", bytes(payload[:10]))
+	t = dict(zip(("cpuavg", "cpupeak", "underruns", "rxdepth", "txdrops"), fields))
+	t["cpuavg"] /= 10.0
+	t["cpupeak"] /= 10.0
+	t["voices"] = voices(payload[10:10 + 3 * NUM_CHANNELS])
+	return t
+
+def telemetry(payload):
+	t = parse_telemetry(payload)
+	vs = ", ".join("%d:i%d n%d %s%.2f" % (ch, ins, note, ADSR_MODES.get(mode, "?"), lvl)
+			for ch, ins, note, mode, lvl in t["voices"])
+	return "cpu %.1f%%/%.1f%% underruns %d midiq %d drops %d voices: %s" % (
+			t["cpuavg"], t["cpupeak"], t["underruns"], t["rxdepth"], t["txdrops"], vs or "-")
+
+DECODERS = { REC_PING: ping, REC_TELEMETRY: telemetry }
+
+def readbyte(s):
+	return bytearray(s.read(1))[0]
+
+def records(s):
+	"""Yield (None, text char) or (record type, payload) from the stream"""
+	while True:
+		b = readbyte(s)
+		if b < 0x80:
+			yield None, chr(b)
+		else:
+			yield b & 0x7f, bytearray(s.read(readbyte(s)))
+
+def main(port, baud=BAUDRATE):
+	s = serial.Serial(port, baud)
+	for rectype, data in records(s):
+		if rectype is None:
+			sys.stdout.write(data)
+			continue
+		decode = DECODERS.get(rectype)
+		if decode:
+			line = decode(data)
+		else:
+			line = "record %d: %s" % (rectype, " ".join("%02x" % x for x in data))
+		sys.stdout.write(line + "\r\n")
+		sys.stdout.flush()
+
+if __name__ == "__main__":
+	main(sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyUSB0",
+			int(sys.argv[2]) if len(sys.argv) > 2 else BAUDRATE)
@@ -147,13 +147,8 @@ CHAN_MAP = [0, 4, 3, -1, 2, -1, -1]
 s = serial.Serial("/dev/ttyUSB0",115200)
 def sendmsg(chan,note,vel):
 	print "msg going",chan,note
-	onoff = 0x40 if note >= 0 else 0
-	note = abs(note)
-	s.write(chr(0x80 | chan | onoff))
-	s.write(chr(0x60 | (note  >> 4)))
-	s.write(chr(0x50 | (note & 0xf)))
-	s.write(chr(0x20 | (vel   >> 4)))
-	s.write(chr(0x10 | (vel  & 0xf)))
+	status = 0x90 if note >= 0 else 0x80
+	s.write(chr(status | chan) + chr(abs(note)) + chr(vel))
 
 
 def printnotes(evs, tpb, bps, endtime):
@@ -13,13 +13,8 @@ ch = 1
 
 def sendmsg(chan,note,vel):
     print "msg going",chan,note
-    onoff = 0x40 if note >= 0 else 0
-    note = abs(note)
-    s.write(chr(0x80 | chan | onoff))
-    s.write(chr(0x60 | (note  >> 4)))
-    s.write(chr(0x50 | (note & 0xf)))
-    s.write(chr(0x20 | (vel   >> 4)))
-    s.write(chr(0x10 | (vel  & 0xf)))
+    status = 0x90 if note >= 0 else 0x80
+    s.write(chr(status | chan) + chr(abs(note)) + chr(vel))
 
 while 1:
     if alsaseq.inputpending():
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+# Synthesize the small default drum kit as 24 kHz mono wavs, to stand in
+# until real recordings are dropped in next to them.
+# usage: cd samples && ./gendrums.py
+import random, struct, wave
+from math import exp, pi, sin
+
+RATE = 24000
+
+def write(name, data):
+	w = wave.open(name, "wb")
+	w.setnchannels(1)
+	w.setsampwidth(2)
+	w.setframerate(RATE)
+	w.writeframes(b"".join(struct.pack("<h", int(max(-1, min(1, x)) * 32000)) for x in data))
+	w.close()
+
+def kick(n):
+	# sine sweeping 150..50 Hz
+	ph = 0
+	for i in range(n):
+		t = i / RATE
+		ph += 2 * pi * (50 + 100 * exp(-t / 0.03)) / RATE
+		yield sin(ph) * exp(-t / 0.12) * min(1, i / 24)
+
+def snare(n):
+	rnd = random.Random(2)
+	lp = 0
+	for i in range(n):
+		t = i / RATE
+		x = rnd.uniform(-1, 1)
+		lp += 0.5 * (x - lp)
+		tone = sin(2 * pi * 185 * t) * exp(-t / 0.04)
+		yield 0.7 * (x - lp) * exp(-t / 0.07) + 0.6 * tone
+
+def hat(n):
+	rnd = random.Random(3)
+	prev = 0
+	for i in range(n):
+		t = i / RATE
+		x = rnd.uniform(-1, 1)
+		yield 0.6 * (x - prev) * exp(-t / 0.02)
+		prev = x
+
+write("kick.wav", kick(int(0.4 * RATE)))
+write("snare.wav", snare(int(0.3 * RATE)))
+write("hat.wav", hat(int(0.12 * RATE)))
@@ -14,6 +14,7 @@ static int16_t * volatile NextBufferSamples;
 static volatile int NextBufferLength;
 static volatile int BufferNumber;
 static volatile bool DMARunning;
+static volatile int Underruns;
 
 void InitializeAudio(int plln, int pllr, int i2sdiv, int i2sodd) {
 	GPIO_InitTypeDef  GPIO_InitStructure;
@@ -217,6 +218,10 @@ bool ProvideAudioBufferWithoutBlocking(void *samples, int numsamples) {
 	return true;
 }
 
+int GetAudioUnderruns() {
+	return Underruns;
+}
+
 static void WriteRegister(uint8_t address, uint8_t value) {
 	while (I2C1 ->SR2 & I2C_SR2_BUSY )
 		;
@@ -281,5 +286,6 @@ void DMA1_Stream7_IRQHandler() {
 		StartAudioDMAAndRequestBuffers();
 	} else {
 		DMARunning = false;
+		Underruns++;
 	}
 }
@@ -24,6 +24,7 @@
 #define DOUBLECLICK_Z                    ((uint8_t)0x60)
 #define SINGLECLICK_Z                    ((uint8_t)0x50)
 #include "stm32f4_discovery_lis302dl.h"
+#include "accel.h"
 /* TIM2 Autoreload and Capture Compare register values */
 #define TIM_ARR                          ((uint16_t)1900)
 #define TIM_CCR                          ((uint16_t)1000)
@@ -62,11 +63,119 @@ static void TIM_Config(void);
 
 /* Private functions ---------------------------------------------------------*/
 
-void accelread(uint8_t *buf) {
-	LIS302DL_Read(Buffer, LIS302DL_OUT_X_ADDR, 6);
-	buf[0] = Buffer[0];
-	buf[1] = Buffer[2];
-	buf[2] = Buffer[4];
+/*
+ * Interrupt driven sampling. The rising edge of INT1 (data ready) starts a
+ * 7 byte full duplex transfer: the address, then X, -, Y, -, Z come back.
+ * SPI1 is DMA2 stream 2 (rx) and 3 (tx), channel 3. The rx completion does
+ * the filtering, so nobody ever waits for the bus after init.
+ */
+
+#define ACCEL_G_PER_DIGIT 0.018 // +-2.3g full scale
+#define ACCEL_LP 0.15 // per sample, ~60 ms at ACCEL_RATE
+#define ACCEL_DEADZONE 0.05 // g, hand tremor and sensor noise
+
+static uint8_t spitx[7] = { LIS302DL_OUT_X_ADDR | 0x80 | 0x40 }; // read, autoincrement
+static uint8_t spirx[7];
+static volatile int spibusy;
+static float accellp[3];
+static volatile float tilt[3];
+
+float accel_tilt(int axis) {
+	return tilt[axis];
+}
+
+static void accel_dma_init(void) {
+	DMA_InitTypeDef DMA_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+	DMA_DeInit(DMA2_Stream2);
+	DMA_DeInit(DMA2_Stream3);
+
+	DMA_InitStructure.DMA_Channel = DMA_Channel_3;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&SPI1->DR;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)spirx;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	DMA_InitStructure.DMA_BufferSize = sizeof(spirx);
+	DMA_Init(DMA2_Stream2, &DMA_InitStructure);
+
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)spitx;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStructure.DMA_BufferSize = sizeof(spitx);
+	DMA_Init(DMA2_Stream3, &DMA_InitStructure);
+
+	DMA_ITConfig(DMA2_Stream2, DMA_IT_TC, ENABLE);
+	NVIC_SetPriority(DMA2_Stream2_IRQn, 11);
+	NVIC_EnableIRQ(DMA2_Stream2_IRQn);
+
+	SPI_I2S_DMACmd(LIS302DL_SPI, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, ENABLE);
+}
+
+static void accel_exti_init(void) {
+	EXTI_InitTypeDef EXTI_InitStructure;
+
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+	SYSCFG_EXTILineConfig(LIS302DL_SPI_INT1_EXTI_PORT_SOURCE, LIS302DL_SPI_INT1_EXTI_PIN_SOURCE);
+
+	EXTI_InitStructure.EXTI_Line = LIS302DL_SPI_INT1_EXTI_LINE;
+	EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+	EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+
+	NVIC_SetPriority(LIS302DL_SPI_INT1_EXTI_IRQn, 11);
+	NVIC_EnableIRQ(LIS302DL_SPI_INT1_EXTI_IRQn);
+}
+
+// Both streams are disabled by the hardware after each transfer.
+static void accel_start(void) {
+	if (spibusy)
+		return;
+	spibusy = 1;
+	DMA_ClearFlag(DMA2_Stream2, DMA_FLAG_TCIF2 | DMA_FLAG_HTIF2 | DMA_FLAG_TEIF2 | DMA_FLAG_FEIF2);
+	DMA_ClearFlag(DMA2_Stream3, DMA_FLAG_TCIF3 | DMA_FLAG_HTIF3 | DMA_FLAG_TEIF3 | DMA_FLAG_FEIF3);
+	DMA_SetCurrDataCounter(DMA2_Stream2, sizeof(spirx));
+	DMA_SetCurrDataCounter(DMA2_Stream3, sizeof(spitx));
+	LIS302DL_CS_LOW();
+	DMA_Cmd(DMA2_Stream2, ENABLE);
+	DMA_Cmd(DMA2_Stream3, ENABLE);
+}
+
+void EXTI0_IRQHandler(void) {
+	if (EXTI_GetITStatus(LIS302DL_SPI_INT1_EXTI_LINE) != RESET) {
+		EXTI_ClearITPendingBit(LIS302DL_SPI_INT1_EXTI_LINE);
+		accel_start();
+	}
+}
+
+void DMA2_Stream2_IRQHandler(void) {
+	if (!DMA_GetITStatus(DMA2_Stream2, DMA_IT_TCIF2))
+		return;
+	DMA_ClearITPendingBit(DMA2_Stream2, DMA_IT_TCIF2);
+	LIS302DL_CS_HIGH();
+	spibusy = 0;
+
+	for (int i = 0; i < 3; i++) {
+		float g = (int8_t)spirx[1 + 2*i] * ACCEL_G_PER_DIGIT;
+		accellp[i] += ACCEL_LP * (g - accellp[i]);
+		float x = accellp[i];
+		tilt[i] = x > ACCEL_DEADZONE ? x - ACCEL_DEADZONE
+			: x < -ACCEL_DEADZONE ? x + ACCEL_DEADZONE : 0;
+	}
+
+	// a sample that got ready during the read has no edge of its own
+	if (GPIO_ReadInputDataBit(LIS302DL_SPI_INT1_GPIO_PORT, LIS302DL_SPI_INT1_PIN))
+		accel_start();
 }
 /**
   * @brief   Main program
@@ -101,8 +210,8 @@ int accelinit(void)
                                                              = 3/100 = 30ms */
   Delay(30);
   
-  /* Configure Interrupt control register: enable Click interrupt1 */
-  ctrl = 0x07;
+  /* Configure Interrupt control register: data ready on interrupt1 */
+  ctrl = 0x04;
   LIS302DL_Write(&ctrl, LIS302DL_CTRL_REG3_ADDR, 1);
   
   /* Enable Interrupt generation on click/double click on Z axis */
@@ -135,6 +244,11 @@ int accelinit(void)
                   
   XOffset = Buffer[0];
   YOffset = Buffer[2];
+
+  /* From here on only by DMA; the read above cleared data ready */
+  accel_dma_init();
+  accel_start();
+  accel_exti_init();
     
   return 0;
   while(1)
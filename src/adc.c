@@ -8,19 +8,99 @@
 // http://myembeddedtutorial.blogspot.fi/2013/12/working-with-stm32f4-temperature-sensor.html
 // http://forum.stellarisiti.com/topic/111-stm32-discovery-adc-with-dma/
 
+struct adcinput {
+	GPIO_TypeDef *port;
+	uint16_t pin;
+	uint8_t channel;
+};
+
+// Free analog pins on the discovery board; pots 0 and 1 are on PA1, PA2.
+// Unconnected ones just read noise.
+static const struct adcinput inputs[] = {
+	{ GPIOA, GPIO_Pin_1, ADC_Channel_1 },
+	{ GPIOA, GPIO_Pin_2, ADC_Channel_2 },
+	{ GPIOA, GPIO_Pin_3, ADC_Channel_3 },
+	{ GPIOB, GPIO_Pin_0, ADC_Channel_8 },
+	{ GPIOB, GPIO_Pin_1, ADC_Channel_9 },
+	{ GPIOC, GPIO_Pin_1, ADC_Channel_11 },
+	{ GPIOC, GPIO_Pin_2, ADC_Channel_12 },
+	{ GPIOC, GPIO_Pin_4, ADC_Channel_14 },
+};
+
+#define NUM_INPUTS (int)(sizeof(inputs) / sizeof(*inputs))
+
+// two halves of ADC_OVERSAMPLE scans each, dma interrupts at each half
+static volatile uint16_t scanbuf[2][ADC_OVERSAMPLE][NUM_INPUTS];
+static volatile uint16_t values[NUM_INPUTS];
+
+static void adc_gpio_init(void) {
+	GPIO_InitTypeDef GPIO_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA | RCC_AHB1Periph_GPIOB
+			| RCC_AHB1Periph_GPIOC, ENABLE);
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AN;
+	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+	for (int i = 0; i < NUM_INPUTS; i++) {
+		GPIO_InitStructure.GPIO_Pin = inputs[i].pin;
+		GPIO_Init(inputs[i].port, &GPIO_InitStructure);
+	}
+}
+
+static void adc_dma_init(void) {
+	DMA_InitTypeDef DMA_InitStructure;
+
+	// ADC1 is DMA2 stream 0 channel 0
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+	DMA_DeInit(DMA2_Stream0);
+
+	DMA_InitStructure.DMA_Channel = DMA_Channel_0;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&ADC1->DR;
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)scanbuf;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	DMA_InitStructure.DMA_BufferSize = sizeof(scanbuf) / sizeof(uint16_t);
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(DMA2_Stream0, &DMA_InitStructure);
+	DMA_ITConfig(DMA2_Stream0, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
+	NVIC_SetPriority(DMA2_Stream0_IRQn, 10);
+	NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+	DMA_Cmd(DMA2_Stream0, ENABLE);
+}
+
+// TIM2 update event triggers each scan
+static void adc_timer_init(void) {
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+	TIM_TimeBaseStructure.TIM_Period = SystemCoreClock / 2 / ADC_SCANRATE - 1;
+	TIM_TimeBaseStructure.TIM_Prescaler = 0;
+	TIM_TimeBaseStructure.TIM_ClockDivision = 0;
+	TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
+	TIM_SelectOutputTrigger(TIM2, TIM_TRGOSource_Update);
+	TIM_Cmd(TIM2, ENABLE);
+}
+
 void adc_init(void) {
 	ADC_InitTypeDef ADC_InitStruct;
 	ADC_CommonInitTypeDef ADC_CommonInitStruct;
 	ADC_DeInit();
 
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, ENABLE);
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC2, ENABLE);
 
-	GPIO_InitTypeDef GPIO_InitStructure;
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_1|GPIO_Pin_2;
-	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AN;
-	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-	GPIO_Init(GPIOA, &GPIO_InitStructure);
+	adc_gpio_init();
+	adc_dma_init();
 
 	ADC_CommonInitStruct.ADC_Mode = ADC_Mode_Independent;
 	ADC_CommonInitStruct.ADC_Prescaler = ADC_Prescaler_Div8;
@@ -29,39 +109,52 @@ void adc_init(void) {
 	ADC_CommonInit(&ADC_CommonInitStruct);
 
 	ADC_InitStruct.ADC_Resolution = ADC_Resolution_12b;
-	ADC_InitStruct.ADC_ScanConvMode = DISABLE;
-	ADC_InitStruct.ADC_ContinuousConvMode = ENABLE;
-	ADC_InitStruct.ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_None;
-	ADC_InitStruct.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T1_CC1;
+	ADC_InitStruct.ADC_ScanConvMode = ENABLE;
+	ADC_InitStruct.ADC_ContinuousConvMode = DISABLE;
+	ADC_InitStruct.ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_Rising;
+	ADC_InitStruct.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T2_TRGO;
 	ADC_InitStruct.ADC_DataAlign = ADC_DataAlign_Right;
-	ADC_InitStruct.ADC_NbrOfConversion = 1;
+	ADC_InitStruct.ADC_NbrOfConversion = NUM_INPUTS;
 	ADC_Init(ADC1, &ADC_InitStruct);
-	ADC_Init(ADC2, &ADC_InitStruct);
-
-	//ADC_RegularChannelConfig(ADC1, ADC_Channel_TempSensor, 1, ADC_SampleTime_144Cycles);
-	ADC_RegularChannelConfig(ADC1, ADC_Channel_1, 1, ADC_SampleTime_15Cycles);
-	ADC_RegularChannelConfig(ADC2, ADC_Channel_2, 1, ADC_SampleTime_15Cycles);
 
-	// Enable internal temperature sensor
-	//ADC_TempSensorVrefintCmd(ENABLE);
+	// pots have some kohms of source impedance, give them time
+	for (int i = 0; i < NUM_INPUTS; i++)
+		ADC_RegularChannelConfig(ADC1, inputs[i].channel, i + 1, ADC_SampleTime_56Cycles);
 
 	// btw. discovery has 3V reference
 
-	// Enable ADC conversion
+	ADC_DMARequestAfterLastTransferCmd(ADC1, ENABLE);
+	ADC_DMACmd(ADC1, ENABLE);
 	ADC_Cmd(ADC1, ENABLE);
-	ADC_Cmd(ADC2, ENABLE);
+
+	adc_timer_init();
 }
 
-int adc_read1(void) {
-	ADC_SoftwareStartConv(ADC1);
-	while (ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET)
-		;
-	return ADC_GetConversionValue(ADC1);
+int adc_num_inputs(void) {
+	return NUM_INPUTS;
 }
 
-int adc_read2(void) {
-	ADC_SoftwareStartConv(ADC2);
-	while (ADC_GetFlagStatus(ADC2, ADC_FLAG_EOC) == RESET)
-		;
-	return ADC_GetConversionValue(ADC2);
+uint16_t adc_read(int input) {
+	return values[input];
+}
+
+// Decimate the half that the dma just filled
+void DMA2_Stream0_IRQHandler(void) {
+	int half;
+	if (DMA_GetITStatus(DMA2_Stream0, DMA_IT_HTIF0)) {
+		DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_HTIF0);
+		half = 0;
+	} else if (DMA_GetITStatus(DMA2_Stream0, DMA_IT_TCIF0)) {
+		DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_TCIF0);
+		half = 1;
+	} else {
+		return;
+	}
+
+	for (int i = 0; i < NUM_INPUTS; i++) {
+		uint32_t sum = 0;
+		for (int j = 0; j < ADC_OVERSAMPLE; j++)
+			sum += scanbuf[half][j][i];
+		values[i] = sum;
+	}
 }
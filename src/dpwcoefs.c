@@ -1 +0,0 @@
-float dpwcoefs[128] = { 1467.99651285, 1385.61823593, 1307.86349672, 1234.47279599, 1165.20119912, 1099.81751858, 1038.10354242, 979.853305979, 924.872404509, 872.977344362, 823.9949306, 777.761688969, 734.123320324, 692.934185666, 654.056820086, 617.361473991, 582.725680075, 550.033844596, 519.176861591, 490.051748748, 462.561303711, 436.613779675, 412.12257919, 389.005965152, 367.186788011, 346.59222829, 327.153553562, 308.805889057, 291.48800115, 275.142093001, 259.71361166, 245.151066006, 231.405854897, 218.432104969, 206.186517537, 194.628224092, 183.718649906, 173.421385288, 163.702064076, 154.528248939, 145.869323123, 137.696388269, 129.982167967, 122.700916725, 115.828334045, 109.341483324, 103.218715299, 97.4395958055, 91.9848375697, 86.8362358455, 81.9766076555, 77.3897344449, 73.0603079538, 68.9738791269, 65.1168098916, 61.4762276419, 58.0399822777, 54.7966056547, 51.7352733108, 48.8457683403, 46.1184472966, 43.5442080073, 41.1144591976, 38.821091817, 36.656451977, 34.6133154065, 32.6848633421, 30.8646597709, 29.1466299517, 27.5250401407, 25.9944784565, 24.5498368186, 23.1862938999, 21.8992990365, 20.684557041, 19.5380138678, 18.4558430839, 17.4344330994, 16.4703751146, 15.5604517448, 14.701626283, 13.8910325668, 13.1259654135, 12.4038715942, 11.7223413133, 11.0791001685, 10.472001562, 9.89901953891, 9.35824202863, 8.84786446637, 8.36618377422, 7.91159268125, 7.48257436394, 7.07769738912, 6.6956109426, 6.33504032775, 5.99478271908, 5.67370315674, 5.37073076894, 5.08485520967, 4.81512330022, 4.56063586351, 4.32054474099, 4.09404998267, 3.88039720119, 3.67887508175, 3.48881304038, 3.30957902323, 3.14057744084, 2.9812472314, 2.83106004806, 2.68951856585, 2.55615490475, 2.43052916605, 2.31222808031, 2.2008637662, 2.09607260097, 1.99751420455, 1.90487054164, 1.81784514811, 1.73616249117, 1.65956747685, 1.58782512283, 1.52072042167, 1.45805842795, 1.39966461466, 1.34538556035, 1.29509005049 };
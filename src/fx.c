@@ -0,0 +1,358 @@
+#include "fx.h"
+#include "synth.h"
+#include "sections.h"
+#include <math.h>
+#include <string.h>
+
+#ifdef __arm__
+#include "stm32f4xx.h"
+#define sat16(x) __SSAT((x), 16)
+#else
+static inline int32_t sat16(int32_t x) {
+	return x < -32768 ? -32768 : x > 32767 ? 32767 : x;
+}
+#endif
+
+// set by fx_init(); the coefficients below are derived from it
+static float fxrate = SYNTH_SAMPLERATE;
+
+// one pole coefficient for a cutoff, or a time constant evaluated every n
+static float onepole_hz(float hz) {
+	return -expm1f(-2 * (float)M_PI * hz / fxrate);
+}
+
+static float onepole_time(float seconds, int n) {
+	return -expm1f(-n / (seconds * fxrate));
+}
+
+
+/***** Master limiter *****/
+
+// Block peak limiter without look-ahead: the gain drops within the block
+// whose peak goes over the threshold and recovers over ~150 ms. Samples
+// that still overshoot while it ramps down go to the soft knee instead of
+// wrapping or hard clipping.
+
+#define LIMIT_THRESHOLD 0.9 // of full scale
+#define LIMIT_RELEASE 0.15 // seconds
+#define CLIP_KNEE 0.75 // linear below, saturates smoothly towards 1 above
+
+static float limitgain;
+static float limitrelease; // per block
+
+static inline float softclip(float x) {
+	float a = fabsf(x);
+	if (a <= CLIP_KNEE)
+		return x;
+	float u = (a - CLIP_KNEE) * (1 / (1 - CLIP_KNEE));
+	float y = CLIP_KNEE + (1 - CLIP_KNEE) * u / (1 + u);
+	return x < 0 ? -y : y;
+}
+
+RAMFUNC void fx_master(const float *l, const float *r, int16_t *out, int n, float gain) {
+	float peak = 0;
+	for (int i = 0; i < n; i++) {
+		float a = fabsf(l[i]), b = fabsf(r[i]);
+		if (a > peak) peak = a;
+		if (b > peak) peak = b;
+	}
+	peak *= gain;
+
+	float target = peak > LIMIT_THRESHOLD ? LIMIT_THRESHOLD / peak : 1;
+	float g0 = limitgain;
+	float g1 = target < g0 ? target : g0 + limitrelease * (target - g0);
+	limitgain = g1;
+
+	float g = gain * g0, dg = gain * (g1 - g0) / n;
+	for (int i = 0; i < n; i++) {
+		out[2*i] = sat16((int32_t)(0x7fff * softclip(g * l[i])));
+		out[2*i+1] = sat16((int32_t)(0x7fff * softclip(g * r[i])));
+		g += dg;
+	}
+}
+
+
+/***** Delay *****/
+
+// The lines hold q15 of the mix divided by DELAY_RANGE. Each block is done in
+// runs over which the write position doesn't wrap. Length changes glide
+// over a few blocks: the read point moves a fraction of a frame per sample
+// and is read with linear interpolation, which bends the pitch a little
+// instead of clicking.
+
+#define DELAY_FRAMES FX_DELAY_FRAMES
+#define DELAY_RANGE 4.0 // mix level at q15 full scale
+#define DELAY_DAMP 2500 // feedback lowpass, Hz
+#define DELAY_GLIDE 0.05 // per block
+#define DELAY_JITTER 0.0005 // seconds, smaller tempo changes are ignored
+
+CCM_BSS static int16_t delaybuf[DELAY_FRAMES][2];
+static int delaypos; // write position
+static float delaylen, delaytarget; // frames
+static float delayfb, delaywet;
+static float delaylp[2];
+static float delaydamp;
+
+RAMFUNC void fx_delay(const float *inl, const float *inr, float *l, float *r, int n) {
+	const float toq = 0x7fff / DELAY_RANGE, fromq = DELAY_RANGE / 0x7fff;
+	float fb = delayfb, wet = delaywet, damp = delaydamp;
+	float lpl = delaylp[0], lpr = delaylp[1];
+
+	float len = delaylen;
+	delaylen += DELAY_GLIDE * (delaytarget - delaylen);
+	float step = (delaylen - len) / n;
+
+	for (int i = 0; i < n; ) {
+		int run = n - i;
+		if (run > DELAY_FRAMES - delaypos)
+			run = DELAY_FRAMES - delaypos;
+		int16_t *w = delaybuf[delaypos];
+		const float *il = inl + i, *ir = inr + i;
+		float *pl = l + i, *pr = r + i;
+		for (int j = 0; j < run; j++) {
+			len += step;
+			float rp = delaypos + j - len; // at least a frame behind
+			if (rp < 0)
+				rp += DELAY_FRAMES;
+			int r0 = (int)rp, r1 = r0 + 1 == DELAY_FRAMES ? 0 : r0 + 1;
+			float fr = rp - r0;
+			float el = (delaybuf[r0][0] + fr * (delaybuf[r1][0] - delaybuf[r0][0])) * fromq;
+			float er = (delaybuf[r0][1] + fr * (delaybuf[r1][1] - delaybuf[r0][1])) * fromq;
+			lpl += damp * (el - lpl);
+			lpr += damp * (er - lpr);
+			// ping pong: each side feeds the other
+			w[2*j] = sat16((int32_t)((il[j] + fb * lpr) * toq));
+			w[2*j+1] = sat16((int32_t)((ir[j] + fb * lpl) * toq));
+			pl[j] += wet * el;
+			pr[j] += wet * er;
+		}
+		i += run;
+		delaypos += run;
+		if (delaypos == DELAY_FRAMES)
+			delaypos = 0;
+	}
+	delaylp[0] = lpl;
+	delaylp[1] = lpr;
+}
+
+void fx_delay_time(float seconds) {
+	float frames = seconds * fxrate;
+	delaytarget = frames < 1 ? 1 : frames > DELAY_FRAMES - 1 ? DELAY_FRAMES - 1 : frames;
+}
+
+// Tempo measured from midi clock jitters by a tick; don't chase that.
+void fx_delay_tempo(float bpm, float beats) {
+	if (bpm <= 0)
+		return;
+	float seconds = 60 * beats / bpm;
+	if (fabsf(seconds * fxrate - delaytarget) >= DELAY_JITTER * fxrate)
+		fx_delay_time(seconds);
+}
+
+void fx_delay_feedback(float feedback) {
+	delayfb = feedback < 0 ? 0 : feedback > 0.95 ? 0.95 : feedback;
+}
+
+void fx_delay_wet(float wet) {
+	delaywet = wet;
+}
+
+
+/***** Chorus / flanger *****/
+
+// Same single ring idea as the reverb, counting up. The sweep is evaluated
+// per block and ramped linearly over it.
+
+#define CHORUS_SIZE 1024 // 21 ms at 48 kHz, power of two
+#define CHORUS_MASK (CHORUS_SIZE - 1)
+#define CHORUS_RANGE 4.0
+
+CCM_BSS static int16_t chorusbuf[CHORUS_SIZE][2];
+static unsigned choruspos;
+static float chorusphase;
+static float chorusdelay[2]; // frames, at the end of the last block
+static float chorusrate, chorusbase, chorusdepth, chorusfb, choruswet;
+
+static inline float chorus_tap(unsigned pos, float delay, int side) {
+	int di = (int)delay;
+	float fr = delay - di;
+	float a = chorusbuf[(pos - di) & CHORUS_MASK][side];
+	float b = chorusbuf[(pos - di - 1) & CHORUS_MASK][side];
+	return (a + fr * (b - a)) * (float)(CHORUS_RANGE / 0x7fff);
+}
+
+RAMFUNC void fx_chorus(const float *inl, const float *inr, float *l, float *r, int n) {
+	const float toq = 0x7fff / CHORUS_RANGE;
+	if (choruswet == 0)
+		return;
+
+	chorusphase += chorusrate * n / fxrate;
+	if (chorusphase >= 1)
+		chorusphase -= 1;
+	float dl = chorusdelay[0], dr = chorusdelay[1];
+	chorusdelay[0] = chorusbase + chorusdepth * sinf(2 * (float)M_PI * chorusphase);
+	chorusdelay[1] = chorusbase + chorusdepth * cosf(2 * (float)M_PI * chorusphase);
+	float stepl = (chorusdelay[0] - dl) / n, stepr = (chorusdelay[1] - dr) / n;
+
+	float fb = chorusfb, wet = choruswet;
+	unsigned pos = choruspos;
+	for (int i = 0; i < n; i++) {
+		float yl = chorus_tap(pos, dl, 0), yr = chorus_tap(pos, dr, 1);
+		chorusbuf[pos & CHORUS_MASK][0] = sat16((int32_t)((inl[i] + fb * yl) * toq));
+		chorusbuf[pos & CHORUS_MASK][1] = sat16((int32_t)((inr[i] + fb * yr) * toq));
+		l[i] += wet * yl;
+		r[i] += wet * yr;
+		dl += stepl;
+		dr += stepr;
+		pos++;
+	}
+	choruspos = pos;
+}
+
+void fx_chorus_set(float rate, float delayms, float depthms, float feedback, float wet) {
+	float maxframes = CHORUS_SIZE - 2;
+	float base = delayms * fxrate * 0.001;
+	float depth = depthms * fxrate * 0.001;
+	if (depth > base - 1)
+		depth = base - 1;
+	if (base + depth > maxframes)
+		base = maxframes - depth;
+	chorusrate = rate;
+	chorusbase = base;
+	chorusdepth = depth < 0 ? 0 : depth;
+	chorusfb = feedback < -0.9 ? -0.9 : feedback > 0.9 ? 0.9 : feedback;
+	choruswet = wet;
+	if (chorusdelay[0] == 0)
+		chorusdelay[0] = chorusdelay[1] = base;
+}
+
+
+/***** Reverb *****/
+
+// All six delays share one power of two ring and a single position that
+// counts down by one per sample: a delay of length L at offset B writes at
+// pos + B and reads back at pos + B + L, both masked. Each sample reads
+// every tap before writing any, since a delay's read slot is the next
+// delay's write slot. No per delay positions, no wrap tests, one AND per
+// access.
+//
+// Budget: 8192 * 2 bytes of SRAM (CCM is taken by the echo) and about 70
+// cycles per sample, ~2 % of the core at 48 kHz; see make BENCH=1. The
+// lengths scale with the rate as far as the ring allows: the same room
+// at 32..48 kHz, half its size at 96 kHz.
+
+#define REVERB_SIZE 8192
+#define REVERB_MASK (REVERB_SIZE - 1)
+#define REVERB_RANGE 4.0 // level at q15 full scale, as in the delay
+#define REVERB_DAMP 3900 // loop lowpass, Hz
+#define REVERB_AP 0.6 // allpass coefficient
+
+enum { AP0, AP1, LINE0, LINE1, LINE2, LINE3, REVERB_TAPS };
+
+// at 48 kHz, mutually prime, the lines 35..45 ms; 8182 samples in all
+static const uint16_t reverbref[REVERB_TAPS] = { 241, 211, 1693, 1847, 2011, 2179 };
+#define REVERB_REFRATE 48000
+#define REVERB_REFSIZE 8182
+static uint16_t reverblen[REVERB_TAPS];
+static uint16_t reverbbase[REVERB_TAPS];
+static int16_t reverbbuf[REVERB_SIZE];
+static unsigned reverbpos;
+static float reverbgain[4]; // per line, from rt60
+static float reverblp[4];
+static float reverbwet;
+static float reverbdamp;
+
+RAMFUNC void fx_reverb(const float *inl, const float *inr, float *l, float *r, int n) {
+	const float toq = 0x7fff / REVERB_RANGE, fromq = REVERB_RANGE / 0x7fff;
+	float wet = reverbwet, damp = reverbdamp;
+	float lp0 = reverblp[0], lp1 = reverblp[1], lp2 = reverblp[2], lp3 = reverblp[3];
+	float g0 = reverbgain[0], g1 = reverbgain[1], g2 = reverbgain[2], g3 = reverbgain[3];
+	unsigned pos = reverbpos;
+
+	for (int i = 0; i < n; i++) {
+		float tap[REVERB_TAPS];
+		for (int k = 0; k < REVERB_TAPS; k++)
+			tap[k] = reverbbuf[(pos + reverbbase[k] + reverblen[k]) & REVERB_MASK] * fromq;
+
+		// diffuse the mono input
+		float x = 0.5f * (inl[i] + inr[i]);
+		float w0 = x - REVERB_AP * tap[AP0];
+		x = tap[AP0] + REVERB_AP * w0;
+		float w1 = x - REVERB_AP * tap[AP1];
+		x = tap[AP1] + REVERB_AP * w1;
+
+		// damped lines through an orthogonal (hadamard / 2) mix
+		lp0 += damp * (tap[LINE0] - lp0);
+		lp1 += damp * (tap[LINE1] - lp1);
+		lp2 += damp * (tap[LINE2] - lp2);
+		lp3 += damp * (tap[LINE3] - lp3);
+		float a = lp0 + lp1, b = lp0 - lp1, c = lp2 + lp3, d = lp2 - lp3;
+
+		int16_t *buf = reverbbuf;
+		buf[(pos + reverbbase[AP0]) & REVERB_MASK] = sat16((int32_t)(w0 * toq));
+		buf[(pos + reverbbase[AP1]) & REVERB_MASK] = sat16((int32_t)(w1 * toq));
+		buf[(pos + reverbbase[LINE0]) & REVERB_MASK] = sat16((int32_t)((x + g0 * 0.5f * (a + c)) * toq));
+		buf[(pos + reverbbase[LINE1]) & REVERB_MASK] = sat16((int32_t)((x + g1 * 0.5f * (b + d)) * toq));
+		buf[(pos + reverbbase[LINE2]) & REVERB_MASK] = sat16((int32_t)((x + g2 * 0.5f * (a - c)) * toq));
+		buf[(pos + reverbbase[LINE3]) & REVERB_MASK] = sat16((int32_t)((x + g3 * 0.5f * (b - d)) * toq));
+		pos--;
+
+		l[i] += wet * (tap[LINE0] + tap[LINE2]);
+		r[i] += wet * (tap[LINE1] + tap[LINE3]);
+	}
+	reverbpos = pos;
+	reverblp[0] = lp0;
+	reverblp[1] = lp1;
+	reverblp[2] = lp2;
+	reverblp[3] = lp3;
+}
+
+void fx_reverb_wet(float wet) {
+	reverbwet = wet;
+}
+
+// each line loses 60 dB over rt60 seconds of its own length's round trips
+void fx_reverb_time(float rt60) {
+	for (int k = 0; k < 4; k++)
+		reverbgain[k] = powf(10, -3.0 * reverblen[LINE0 + k] / (rt60 * fxrate));
+}
+
+static void reverb_init(void) {
+	float scale = fxrate / REVERB_REFRATE;
+	if (scale * REVERB_REFSIZE > REVERB_SIZE)
+		scale = (float)REVERB_SIZE / REVERB_REFSIZE;
+	int base = 0;
+	for (int k = 0; k < REVERB_TAPS; k++) {
+		reverblen[k] = (int)(reverbref[k] * scale) | 1; // odd keeps them apart
+		reverbbase[k] = base;
+		base += reverblen[k];
+	}
+	reverbdamp = onepole_hz(REVERB_DAMP);
+	memset(reverbbuf, 0, sizeof(reverbbuf));
+	memset(reverblp, 0, sizeof(reverblp));
+	reverbpos = 0;
+	fx_reverb_time(1.8);
+	fx_reverb_wet(1);
+}
+
+
+// Also silences the lines, so the effects restart the same on every call.
+void fx_init(int samplerate) {
+	fxrate = samplerate;
+	limitgain = 1;
+	memset(delaybuf, 0, sizeof(delaybuf));
+	memset(delaylp, 0, sizeof(delaylp));
+	delaypos = 0;
+	memset(chorusbuf, 0, sizeof(chorusbuf));
+	choruspos = 0;
+	chorusphase = 0;
+	chorusdelay[0] = chorusdelay[1] = 0; // start at the base delay
+	limitrelease = onepole_time(LIMIT_RELEASE, SYNTH_BLOCK);
+	delaydamp = onepole_hz(DELAY_DAMP);
+	fx_delay_time(60 * FX_DELAY_BEATS / 120);
+	delaylen = delaytarget;
+	fx_delay_feedback(0.35);
+	fx_delay_wet(1);
+	fx_chorus_set(0.6, 10, 3, 0, 1);
+	reverb_init();
+}
@@ -0,0 +1,45 @@
+#ifndef FX_H
+#define FX_H
+
+#include <stdint.h>
+
+// Master bus processing after the voice mix, once per block of at most
+// SYNTH_BLOCK frames. The shared effects are fed from send buses and add
+// their output to the master; in and out may be the same buffers.
+
+#define FX_SEND_CHORUS 0
+#define FX_SEND_DELAY 1
+#define FX_SEND_REVERB 2
+#define FX_NUM_SENDS 3
+
+void fx_init(int samplerate);
+
+// Stereo echo with cross feedback and a lowpass in the loop, in CCM.
+#define FX_DELAY_FRAMES 12000 // 375 ms at 32 kHz, 250 ms at 48, 125 ms at 96
+#define FX_DELAY_BEATS 0.375 // dotted sixteenth when synced to a tempo
+
+void fx_delay(const float *inl, const float *inr, float *l, float *r, int n);
+void fx_delay_time(float seconds); // clamped to FX_DELAY_FRAMES
+void fx_delay_tempo(float bpm, float beats);
+void fx_delay_feedback(float feedback); // 0..<1
+void fx_delay_wet(float wet);
+
+// Chorus / flanger: a short delay swept by a block rate sine, read with
+// linear interpolation, the right side a quarter cycle behind the left.
+// Chorus is around 10 ms +-3 ms at under 1 Hz without feedback, flanger
+// 1 ms +-0.8 ms with feedback 0.5..0.8. Delay + depth up to 1022 frames,
+// 20 ms at 48 kHz.
+void fx_chorus(const float *inl, const float *inr, float *l, float *r, int n);
+void fx_chorus_set(float rate, float delayms, float depthms, float feedback, float wet);
+
+// Reverb: a 4 line feedback delay network behind two diffusing allpasses,
+// all in one 16 KB q15 ring in SRAM.
+void fx_reverb(const float *inl, const float *inr, float *l, float *r, int n);
+void fx_reverb_wet(float wet);
+void fx_reverb_time(float rt60); // seconds at low frequencies, highs die sooner
+
+// Limit and soft clip the mix scaled by gain (1.0 = full scale) into
+// interleaved int16 without wrapping.
+void fx_master(const float *l, const float *r, int16_t *out, int n, float gain);
+
+#endif
@@ -1,20 +1,301 @@
-#!/usr/bin/python2
+#!/usr/bin/env python3
+# Generate the synth's tables: the fm sine, the oversampling half-band
+# filters, and the instrument patches in patches.json compiled to
+# patches.c, with their indices in patches.h for the midi channel maps.
+# Anything that depends on the sample rate is derived by synth_init()
+# instead: times stay in seconds here.
+# Sample files are relative to src/.
+# usage: cd src && ./gen_coefs.py
+import json, struct, wave
+from math import pi, sin, sqrt
 
-def midifreq(p):
-	return pow(2, (p - 69) / 12.0) * 440
+# quarter sine in q15 for the fm operators, SINE_BITS in synth.c
+SINE_BITS = 8
+quarter = [int(round(32767 * sin(pi / 2 * i / (1 << SINE_BITS))))
+		for i in range((1 << SINE_BITS) + 1)]
+open("sinetab.c", "w").write("static const int16_t sinetab[%d] = { %s };\n" % (
+		len(quarter), ", ".join(map(str, quarter))))
 
-rate = 48e3
-notes = range(128)
-freqs = map(midifreq, notes)
+# Half-band lowpass filters for decimating oversampled voices by two,
+# kaiser windowed sincs of 4k - 1 taps. Every other tap but the center
+# one (0.5) is zero, so only the k odd taps on one side are stored,
+# from the center out. hbfinal goes from twice the rate to the rate:
+# flat within 0.1 dB to 0.4 of the rate, down 80 dB from 0.64 so that
+# nothing folds below 0.36. hbfirst is the 4x to 2x stage: its aliases
+# only need to miss what hbfinal keeps.
+def bessel_i0(x):
+	s = t = 1.0
+	for k in range(1, 40):
+		t *= (x / 2 / k) ** 2
+		s += t
+	return s
 
-coefs = [rate / (4 * freq * (1 - freq / rate))
-		for freq in freqs]
+def halfband(k, beta):
+	c = 2 * k - 1
+	h = []
+	for j in range(k):
+		m = 2 * j + 1
+		w = bessel_i0(beta * sqrt(1 - (m / c) ** 2)) / bessel_i0(beta)
+		h.append((-1) ** j / (pi * m) * w)
+	norm = 0.25 / sum(h) # unity at dc
+	return [x * norm for x in h]
 
-ticks = [freq / (rate / 2)
-		for freq in freqs]
+def floattable(name, values):
+	return "static const float %s[%d] = { %s };\n" % (name, len(values),
+			", ".join("%.9g" % x for x in values))
 
-open("dpwcoefs.c", "w").write(
-    "float dpwcoefs[128] = { %s };\n" % ", ".join(map(str, coefs)))
+open("halfband.c", "w").write(floattable("hbfirst", halfband(4, 6)) +
+		floattable("hbfinal", halfband(10, 8)))
 
-open("sawticks.c", "w").write(
-    "float sawticks[128] = { %s };\n" % ", ".join(map(str, ticks)))
+# Patches. An instrument kind is an oscillator and a filter; each kind
+# used by some patch gets a render loop in synth.c through the
+# INSTRUMENT_KINDS registry, so patches of the same kind share code.
+# New oscillators and filters are added here and in synth.c's
+# Instruments section.
+
+UNISON_MAX = 8 # as in synth.c
+
+# name: (start function, per sample eval)
+OSCS = {
+	"dpw": ("osc_dpw_start", "osc_dpw_eval"),
+	"noise": ("osc_noise_start", "osc_noise_eval"),
+	"pink": ("osc_noise_start", "osc_pink_eval"),
+	"brown": ("osc_noise_start", "osc_brown_eval"),
+	"pulse": ("osc_pulse_start", "pls_dpw_eval"),
+	"unison": ("osc_unison_start", "osc_unison_eval"),
+	"sample": ("osc_sample_start", "osc_sample_eval"),
+	"fm": ("osc_fm_start", "osc_fm_eval"),
+}
+
+FILTERS = {
+	"none": ("filt_none_start", "filt_none_eval"),
+	"lp": ("filt_lp_start", "filt_lp_eval"),
+	"hp": ("filt_hp_start", "filt_hp_eval"),
+	"tejeez": ("filt_tejeez_start", "filt_tejeez_eval"),
+}
+
+SRCS = {
+	"none": "MOD_SRC_NONE", "one": "MOD_SRC_ONE", "lfo": "MOD_SRC_LFO",
+	"glfo": "MOD_SRC_GLFO", "env": "MOD_SRC_ENV",
+	"velocity": "MOD_SRC_VELOCITY", "bend": "MOD_SRC_BEND",
+	"accelx": "MOD_SRC_ACCEL(0)", "accely": "MOD_SRC_ACCEL(1)",
+	"accelz": "MOD_SRC_ACCEL(2)",
+}
+SRCS.update(("pot%d" % i, "MOD_SRC_POT(%d)" % i) for i in range(8))
+
+DSTS = ["pitch", "cutoff", "duty", "amp", "lforate", "pan"]
+INSERTS = ["none", "dist", "filter", "crush"]
+SENDS = ["chorus", "delay", "reverb"] # FX_SEND_* order
+
+def num(x):
+	return "%d" % x if x == int(x) else repr(float(x))
+
+# Envelope times in seconds to 1/e and the sustain level. Zero time jumps
+# straight to the target.
+def adsr(a, d, s, r):
+	return "{ %s, %s, %s, %s }" % tuple(map(num, (a, d, s, r)))
+
+def kindname(p):
+	return ("%s_%s" % (p["osc"], p["filter"])).upper()
+
+def route(r):
+	src, via, dst, amount = r
+	return "\t{ %s, %s, MOD_DST_%s, %s },\n" % (
+			SRCS[src], SRCS[via], dst.upper(), num(amount))
+
+def bus(b):
+	insert = b.get("insert", ["none"])
+	assert insert[0] in INSERTS, insert
+	a, b2 = (list(insert[1:]) + [0, 0])[:2]
+	assert insert[0] != "dist" or a > 0, "dist needs a drive above 0"
+	sends = b.get("sends", {})
+	for k in sends:
+		assert k in SENDS, k
+	return "{ INSERT_%s, %s, %s, %s, { %s } }" % (insert[0].upper(), num(a), num(b2),
+			num(b.get("level", 1)), ", ".join(num(sends.get(k, 0)) for k in SENDS))
+
+# Sample player zones, from 16 bit wav files. Stereo is mixed to mono.
+IMA_STEPS = [
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37,
+	41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173,
+	190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+	724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894,
+	6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289,
+	16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+def readwav(name):
+	w = wave.open(name, "rb")
+	assert w.getsampwidth() == 2, name + ": not 16 bit"
+	nch = w.getnchannels()
+	raw = struct.unpack("<%dh" % (w.getnframes() * nch), w.readframes(w.getnframes()))
+	frames = [sum(raw[i:i + nch]) // nch for i in range(0, len(raw), nch)]
+	return frames, w.getframerate()
+
+def pcm(frames):
+	return bytearray(struct.pack("<%dh" % len(frames), *frames))
+
+def ulaw(frames):
+	out = bytearray()
+	for x in frames:
+		sign = 0x80 if x < 0 else 0
+		x = min(abs(x), 32635) + 0x84
+		exponent = max(0, x.bit_length() - 8)
+		mantissa = (x >> (exponent + 3)) & 0x0f
+		out.append(~(sign | exponent << 4 | mantissa) & 0xff)
+	return out
+
+# ima adpcm, low nibble first; the decoder in synth.c mirrors the state.
+# Also returns the decoder state at frame loop for restarting the loop.
+def adpcm(frames, loop):
+	out = bytearray((len(frames) + 1) // 2)
+	pred, index = 0, 0
+	loopstate = (0, 0)
+	for i, x in enumerate(frames):
+		if i == loop:
+			loopstate = (pred, index)
+		step = IMA_STEPS[index]
+		diff = x - pred
+		nib = 8 if diff < 0 else 0
+		diff = abs(diff)
+		delta = step >> 3
+		if diff >= step:
+			nib |= 4
+			diff -= step
+			delta += step
+		if diff >= step >> 1:
+			nib |= 2
+			diff -= step >> 1
+			delta += step >> 1
+		if diff >= step >> 2:
+			nib |= 1
+			delta += step >> 2
+		pred = max(-32768, min(32767, pred - delta if nib & 8 else pred + delta))
+		index = max(0, min(88, index + IMA_INDEX[nib & 7]))
+		out[i >> 1] |= nib << ((i & 1) * 4)
+	return out, loopstate
+
+def bytetable(name, data):
+	rows = [", ".join("0x%02x" % b for b in data[i:i+16])
+			for i in range(0, len(data), 16)]
+	return "static const uint8_t %s[] = {\n\t%s\n};\n\n" % (name, ",\n\t".join(rows))
+
+def zones(p):
+	out = ""
+	entries = []
+	for i, z in enumerate(p["samples"]):
+		frames, srate = readwav(z["file"])
+		loopstart, loopend = z.get("loop", [0, 0])
+		assert 0 <= loopstart <= loopend <= len(frames), z["file"]
+		lo, hi = z["keys"]
+		codec = z.get("codec", "pcm")
+		loopstate = (0, 0)
+		if codec == "pcm":
+			data = pcm(frames)
+		elif codec == "ulaw":
+			data = ulaw(frames)
+		elif codec == "adpcm":
+			data, loopstate = adpcm(frames, loopstart)
+		else:
+			assert False, codec
+		name = "%s_zone%d" % (p["name"], i)
+		out += "// %s, %d frames at %d Hz, %s\n" % (z["file"], len(frames), srate, codec)
+		out += bytetable(name, data)
+		entries.append("\t{ %s, %d, %d, %d, %d, %d, SAMPLE_%s, %d, %d, %d, %s },\n" % (
+				name, len(frames), loopstart, loopend, loopstate[0], loopstate[1],
+				codec.upper(), lo, hi, z.get("root", lo), num(srate)))
+	out += "static const SampleZone %s_zones[] = {\n%s};\n\n" % (p["name"], "".join(entries))
+	return out
+
+# fm operators: ratio, level, decay time in seconds (0 holds) and the
+# operator modulated ("to"), absent for carriers
+def fm(p):
+	f = p["fm"]
+	ops = f["ops"]
+	assert 1 <= len(ops) <= 4, p["name"]
+	entries = []
+	for i, op in enumerate(ops):
+		dst = op.get("to", -1)
+		assert dst < i and (i > 0 or dst < 0), "%s: operator %d modulates upwards" % (p["name"], i)
+		entries.append("{ %s, %s, %s, %d }" % (num(op.get("ratio", 1)), num(op["level"]),
+				num(op.get("decay", 0)), dst))
+	return "static const FmParams %s_fm = {\n\t%d, %s,\n\t{ %s }\n};\n\n" % (
+			p["name"], len(ops), num(f.get("feedback", 0)), ",\n\t  ".join(entries))
+
+def patch(p):
+	name = p["name"]
+	for r in p.get("routes", []):
+		assert r[2] in DSTS, r
+	out = ""
+	if "samples" in p:
+		out += zones(p)
+	if "fm" in p:
+		out += fm(p)
+	if "comment" in p:
+		out += "// %s\n" % p["comment"]
+	out += "static const ModRoute %s_routes[] = {\n" % name
+	out += "".join(route(r) for r in p.get("routes", []))
+	out += "\t{ MOD_SRC_NONE }\n};\n\n"
+	fields = [
+		("kind", "INSTR_" + kindname(p)),
+		("adsrtimes", adsr(*p["adsr"])),
+		("modenvtimes", adsr(*p.get("modenv", [0, 0, 0, 0]))),
+	]
+	fields += [(f, num(p[f]))
+			for f in ("cutoff", "duty", "lforate", "pan", "spread", "lanes", "detune")
+			if p.get(f, 0)]
+	oversample = p.get("oversample", 1)
+	assert oversample in (1, 2, 4), name
+	if p["osc"] == "unison":
+		assert 1 <= p.get("lanes", 0) <= UNISON_MAX, name + ": lanes"
+	if p["osc"] == "fm":
+		assert "fm" in p, name + ": no fm block"
+	if p["osc"] == "sample":
+		assert p.get("samples"), name + ": no samples"
+	if oversample > 1:
+		fields.append(("oversample", "%d" % oversample))
+	if "samples" in p:
+		fields += [
+			("zones", "%s_zones" % name),
+			("numzones", "%d" % len(p["samples"])),
+		]
+	if "fm" in p:
+		fields.append(("fm", "&%s_fm" % name))
+	fields += [
+		("routes", "%s_routes" % name),
+		("bus", bus(p.get("bus", {}))),
+	]
+	out += "CCM_DATA static Instrument patch_%s = {\n" % name
+	out += "".join("\t.%s = %s,\n" % f for f in fields)
+	out += "};\n\n"
+	return out
+
+patches = json.load(open("patches.json"))
+names = [p["name"] for p in patches]
+assert len(set(names)) == len(names), "duplicate patch names"
+assert len(patches) <= 64, "synth_dump() has 6 bits for the instrument"
+
+kinds = []
+for p in patches:
+	assert p["osc"] in OSCS and p["filter"] in FILTERS, p["name"]
+	if kindname(p) not in [k for k, _ in kinds]:
+		kinds.append((kindname(p), OSCS[p["osc"]] + FILTERS[p["filter"]]))
+
+out = "// Generated from patches.json by gen_coefs.py, do not edit.\n\n"
+out += "#define INSTRUMENT_KINDS(X) \\\n"
+out += " \\\n".join("\tX(%s, %s, %s, %s, %s)" % ((k,) + fns) for k, fns in kinds)
+out += "\n\nenum { INSTRUMENT_KINDS(KIND_ENUM) };\n\n"
+out += "".join(map(patch, patches))
+out += "CCM_DATA Instrument* instruments[] = {\n"
+out += "".join("\t&patch_%s,\n" % n for n in names)
+out += "};\n"
+open("patches.c", "w").write(out)
+
+# instruments[] indices by name, for the code that picks instruments
+out = "// Generated from patches.json by gen_coefs.py, do not edit.\n\n"
+out += "#ifndef PATCHES_H\n#define PATCHES_H\n\n"
+out += "enum {\n%s\tNUM_PATCHES\n};\n\n" % "".join("\tPATCH_%s,\n" % n.upper() for n in names)
+out += "#endif\n"
+open("patches.h", "w").write(out)
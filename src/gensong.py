@@ -0,0 +1,11 @@
+#!/usr/bin/python
+# Embed a midi file into flash as a const array for the smf player.
+# usage: gensong.py ../mididump/isi.mid > song.c
+from sys import argv, stdout
+
+data = bytearray(open(argv[1], "rb").read())
+rows = [", ".join("0x%02x" % b for b in data[i:i+16])
+		for i in range(0, len(data), 16)]
+stdout.write("#include <stdint.h>\n\n"
+		"const uint8_t song_mid[] = {\n\t%s\n};\n"
+		"const uint32_t song_mid_len = sizeof(song_mid);\n" % ",\n\t".join(rows))
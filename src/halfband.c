@@ -0,0 +1,2 @@
+static const float hbfirst[4] = { 0.300649115, -0.0626796865, 0.0127062527, -0.000675680872 };
+static const float hbfinal[10] = { 0.315014613, -0.0965987519, 0.0489196187, -0.0269019725, 0.0145461964, -0.00734679713, 0.00331062906, -0.00124788709, 0.000343532826, -3.9181334e-05 };
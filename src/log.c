@@ -0,0 +1,32 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "log.h"
+#include "uart.h"
+
+#define LOG_TEXT_MAX 128
+
+void log_printf(const char *fmt, ...) {
+	char buf[LOG_TEXT_MAX];
+	va_list ap;
+
+	va_start(ap, fmt);
+	int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+
+	if (n > (int)sizeof(buf) - 1)
+		n = sizeof(buf) - 1;
+	if (n > 0)
+		uart_write(buf, n);
+}
+
+void log_record(int type, const void *payload, int len) {
+	uint8_t buf[2 + LOG_RECORD_MAX];
+
+	if (len > LOG_RECORD_MAX)
+		len = LOG_RECORD_MAX;
+	buf[0] = 0x80 | type;
+	buf[1] = len;
+	memcpy(buf + 2, payload, len);
+	uart_write(buf, 2 + len); // in one piece so records never interleave
+}
@@ -2,13 +2,20 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <math.h>
-#include <ctype.h>
 #include "stm32f4xx_conf.h"
 #include "utils.h"
 #include "Audio.h"
 #include "adc.h"
+#include "accel.h"
+#include "uart.h"
+#include "log.h"
+#include "cycles.h"
+#include "telemetry.h"
 #include "synth.h"
+#include "fx.h"
 #include "seq.h"
+#include "smf.h"
+#include "midi.h"
 
 // Private variables
 volatile uint32_t time_var1, time_var2;
@@ -20,39 +27,175 @@ void init();
 volatile int nextbuf;
 volatile int buf_consumed;
 #define AUDIOBUFSIZE 2048
+
+// Output rate, make RATE=32000 for more voices or RATE=96000 for cleaner
+// highs; the synth derives its tables for it at startup. Only the rates
+// with an Audio*HzSettings preset in Audio.h can be clocked.
+#ifndef AUDIO_RATE
+#define AUDIO_RATE SYNTH_SAMPLERATE
+#endif
+
+#if AUDIO_RATE != 8000 && AUDIO_RATE != 16000 && AUDIO_RATE != 22050 && \
+		AUDIO_RATE != 32000 && AUDIO_RATE != 44100 && AUDIO_RATE != 48000 && \
+		AUDIO_RATE != 96000
+#error "RATE has no Audio*HzSettings preset in Audio.h"
+#endif
+
+static const struct {
+	int rate;
+	int plln, pllr, i2sdiv, i2sodd;
+} audiorates[] = {
+	{ 8000, Audio8000HzSettings },
+	{ 16000, Audio16000HzSettings },
+	{ 22050, Audio22050HzSettings },
+	{ 32000, Audio32000HzSettings },
+	{ 44100, Audio44100HzSettings },
+	{ 48000, Audio48000HzSettings },
+	{ 96000, Audio96000HzSettings },
+};
+
+static int audiorate; // index in audiorates
+static int samplerate;
+
+// always found, see the #error above
+static int audio_rate(int rate) {
+	int i;
+	for (i = 0; i < (int)(sizeof(audiorates) / sizeof(*audiorates)) - 1; i++)
+		if (audiorates[i].rate == rate)
+			break;
+	return i;
+}
 static int16_t audio_buffer[2][AUDIOBUFSIZE];
 
+extern const uint8_t song_mid[];
+extern const uint32_t song_mid_len;
+static struct smfplayer song;
+static volatile int songplaying;
+
+static struct midiparser midiin;
+static void midi_init_instruments(void);
+static void midi_poll(void);
+
 #define BUTTON (GPIOA->IDR & GPIO_Pin_0)
 void fillbuf(int16_t* buf) {
 	//static uint32_t time;
 
+	uint32_t start = cycles();
 	GPIO_SetBits(GPIOD, GPIO_Pin_14);
-	for (int i = 0; i < AUDIOBUFSIZE/2; i++) {
-		//int16_t sample = 0x7fff * (2.0 * time * (1.0f / 44100.0) * 123.0);
-		//int16_t sample = 0x7fff * sinf(2.0 * 3.14159 * time * (1.0f / 44100.0) * 123.0);
-		//float t = time * (1.0 / 44100.0);
-		int16_t sample = synth_sample();// 0x7fff * tejeezfilt(saw(t * 123.0));
-		//time++;
-		buf[2*i] = sample;
-		buf[2*i+1] = sample;
+	// midi input and song events are handled at each block
+	for (int i = 0; i < AUDIOBUFSIZE/2; i += SYNTH_BLOCK) {
+		midi_poll();
+		if (songplaying) {
+			songplaying = smf_play(&song, SYNTH_BLOCK);
+			fx_delay_tempo(60e6 / song.tempo, FX_DELAY_BEATS);
+		}
+		synth_render(buf + 2*i, SYNTH_BLOCK);
 	}
 	GPIO_ResetBits(GPIOD, GPIO_Pin_14);
+	telemetry_render(cycles() - start);
+}
+
+static volatile int dotelemetry;
+
+// Pots only count as moved when they get further than the adc noise from
+// where they were last taken, so idle pots cause no recomputation. Within
+// the noise of either end they snap to it, so the ends can be reached.
+#define POT_HYSTERESIS 48 // of ADC_MAXVALUE
+static int pots[SYNTH_NUM_POTS] = { [0 ... SYNTH_NUM_POTS - 1] = -ADC_MAXVALUE };
+
+static int pot_moved(int i) {
+	int v = adc_read(i);
+	if (v < POT_HYSTERESIS)
+		v = 0;
+	else if (v > ADC_MAXVALUE - POT_HYSTERESIS)
+		v = ADC_MAXVALUE;
+	int end = v == 0 || v == ADC_MAXVALUE;
+	if (v == pots[i] || (!end && abs(v - pots[i]) < POT_HYSTERESIS))
+		return 0;
+	pots[i] = v;
+	return 1;
 }
 
-volatile int dodump;
 
-int accelinit(void);
-void accelread(uint8_t*);
+#ifdef SYNTH_BENCH
+/*
+ * Render a second with every channel busy and log the cost, before the
+ * audio starts. Compare builds with and without RAMFUNC/NOCCM.
+ */
+static void bench(void) {
+	static int16_t buf[2 * SYNTH_BLOCK];
+	for (int i = 0; i < SYNTH_NUM_CHANNELS; i++)
+		synth_note_on(36 + 3 * i, i % synth_num_instruments(), 1.0);
+	uint32_t start = cycles();
+	for (int n = 0; n < samplerate; n += SYNTH_BLOCK)
+		synth_render(buf, SYNTH_BLOCK);
+	uint32_t t = cycles() - start;
+	synth_kill();
+	log_printf("bench: %u cycles/sample with %d channels\r\n",
+			(unsigned)(t / samplerate), SYNTH_NUM_CHANNELS);
+
+	// effects alone, on silence; their cost doesn't depend on the signal
+	static float l[SYNTH_BLOCK], r[SYNTH_BLOCK];
+	start = cycles();
+	for (int n = 0; n < samplerate; n += SYNTH_BLOCK)
+		fx_delay(l, r, l, r, SYNTH_BLOCK);
+	t = cycles() - start;
+	log_printf("bench: delay %u cycles/block\r\n",
+			(unsigned)(t / (samplerate / SYNTH_BLOCK)));
+	start = cycles();
+	for (int n = 0; n < samplerate; n += SYNTH_BLOCK)
+		fx_reverb(l, r, l, r, SYNTH_BLOCK);
+	t = cycles() - start;
+	log_printf("bench: reverb %u cycles/block\r\n",
+			(unsigned)(t / (samplerate / SYNTH_BLOCK)));
+	start = cycles();
+	for (int n = 0; n < samplerate; n += SYNTH_BLOCK)
+		fx_chorus(l, r, l, r, SYNTH_BLOCK);
+	t = cycles() - start;
+	log_printf("bench: chorus %u cycles/block\r\n",
+			(unsigned)(t / (samplerate / SYNTH_BLOCK)));
+}
+#endif
+
+/*
+ * A seed for the noise from the hardware rng, which runs from the 48 MHz
+ * pll output. 0 if it doesn't come up, the synth keeps its own seed then.
+ */
+static uint32_t rng_seed(void) {
+	uint32_t seed = 0;
+	RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_RNG, ENABLE);
+	RNG_Cmd(ENABLE);
+	for (int i = 0; i < 10000; i++) {
+		if (RNG_GetFlagStatus(RNG_FLAG_DRDY) == SET) {
+			seed = RNG_GetRandomNumber();
+			break;
+		}
+	}
+	RNG_Cmd(DISABLE);
+	RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_RNG, DISABLE);
+	return seed;
+}
 
 int main(void) {
+	audiorate = audio_rate(AUDIO_RATE);
+	samplerate = audiorates[audiorate].rate;
 	init();
 	int volume = 0;
+	int songon = 0;
 
-	InitializeAudio(Audio48000HzSettings);
+	InitializeAudio(audiorates[audiorate].plln, audiorates[audiorate].pllr,
+			audiorates[audiorate].i2sdiv, audiorates[audiorate].i2sodd);
 	adc_init();
 
-	synth_init();
+	synth_init(samplerate);
+	synth_seed(rng_seed());
+#ifdef SYNTH_BENCH
+	bench();
+#endif
 	seq_init();
+	midi_init(&midiin);
+	midi_init_instruments();
+	smf_open(&song, song_mid, song_mid_len, samplerate);
 
 	accelinit();
 
@@ -64,13 +207,16 @@ int main(void) {
 		/*
 		 * Check if user button is pressed
 		 */
-		//printf("* %d  %d\r\n", adc_read1(), adc_read2());
-		int8_t acce[3];
-		accelread((uint8_t*)acce);
-		synth_setvolume((50 - abs(acce[1])) / 50.0);
-		synth_setparams(adc_read1(), 0);
-		synth_setparams(adc_read2(), 1);
-		//printf("%+03d %+03d %+03d\r\n", acce[0], acce[1], acce[2]);
+		//printf("* %d  %d\r\n", adc_read(0), adc_read(1));
+		// tilting sideways by 0.9g mutes
+		float vol = 1 - fabsf(accel_tilt(1)) / 0.9;
+		synth_setvolume(vol < 0 ? 0 : vol);
+		for (int i = 0; i < 3; i++)
+			synth_setcontrol(SYNTH_CTRL_ACCELX + i, accel_tilt(i));
+		for (int i = 0; i < adc_num_inputs() && i < SYNTH_NUM_POTS; i++) {
+			if (pot_moved(i))
+				synth_setcontrol(SYNTH_CTRL_POT0 + i, (float)pots[i] / ADC_MAXVALUE);
+		}
 		if (BUTTON) {
 			// Debounce
 			Delay(10);
@@ -79,6 +225,12 @@ int main(void) {
 				synth_kill();
 				seq_init();
 
+				// Toggle playback of the embedded song from the start
+				songon = !songon;
+				songplaying = 0;
+				smf_rewind(&song);
+				songplaying = songon;
+
 				// Toggle audio volume
 				if (volume) {
 					volume = 0;
@@ -91,9 +243,9 @@ int main(void) {
 				while(BUTTON){};
 			}
 		}
-		if (dodump) {
-			dodump = 0;
-			synth_dump();
+		if (dotelemetry) {
+			dotelemetry = 0;
+			telemetry_send();
 		}
 		if (buf_consumed) {
 			int buf = nextbuf;
@@ -138,9 +290,14 @@ static void AudioCallback(void *context, int buffer) {
 #endif
 }
 
+// 31250 for a real midi port, 115200 for a usb serial dongle
+#define MIDI_BAUDRATE 115200
+
 void init() {
 	GPIO_InitTypeDef  GPIO_InitStructure;
-	USART_InitTypeDef USART_InitStructure;
+	cycles_init();
+	telemetry_init(SystemCoreClock / samplerate * (AUDIOBUFSIZE/2));
+
 	// ---------- SysTick timer -------- //
 	if (SysTick_Config(SystemCoreClock / 1000)) {
 		// Capture error
@@ -150,8 +307,9 @@ void init() {
 	// Enable full access to FPU (Should be done automatically in system_stm32f4xx.c):
 	//SCB->CPACR |= ((3UL << 10*2)|(3UL << 11*2));  // set CP10 and CP11 Full Access
 
-	// GPIOD Periph clock enable
+	// GPIOD Periph clock enable, GPIOA for the user button
 	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOD, ENABLE);
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
 
 	// Configure PD12, PD13, PD14 and PD15 in output pushpull mode
 	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_12 | GPIO_Pin_13| GPIO_Pin_14| GPIO_Pin_15;
@@ -162,85 +320,123 @@ void init() {
 	GPIO_Init(GPIOD, &GPIO_InitStructure);
 
 
-	// ------ UART ------ //
+	uart_init(MIDI_BAUDRATE);
+}
 
-	// Clock
-	RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
-	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
+static int seqtime, seqenabled;
+// sequencer follows midi clock after a start/continue, systick otherwise
+static int extclock, midiclocks, beatclocks;
+static volatile uint32_t msticks;
+static uint32_t lastbeat;
 
-	// IO
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5 | GPIO_Pin_6;
-	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-	GPIO_InitStructure.GPIO_OType = GPIO_OType_PP; // pushpull
-	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-	GPIO_Init(GPIOD, &GPIO_InitStructure);
+// instrument of each midi channel, changed with program change
+static int midiinstr[16];
 
-	GPIO_PinAFConfig(GPIOD, GPIO_PinSource5, GPIO_AF_USART2);
-	GPIO_PinAFConfig(GPIOD, GPIO_PinSource6, GPIO_AF_USART2);
-
-	// Conf
-	USART_InitStructure.USART_BaudRate = 115200;
-	USART_InitStructure.USART_WordLength = USART_WordLength_8b;
-	USART_InitStructure.USART_StopBits = USART_StopBits_1;
-	USART_InitStructure.USART_Parity = USART_Parity_No;
-	USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-	USART_InitStructure.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
-	USART_Init(USART2, &USART_InitStructure);
-
-	USART_ITConfig(USART2, USART_IT_RXNE, ENABLE);
-	
-	NVIC_InitTypeDef NVIC_InitStructure;
-	NVIC_InitStructure.NVIC_IRQChannel = USART2_IRQn;
-	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
-	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
-	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-	NVIC_Init(&NVIC_InitStructure);
-
-	// Enable
-	USART_Cmd(USART2, ENABLE);
+void seqplay(int tick);
+
+static void midi_init_instruments(void) {
+	for (int i = 0; i < 16; i++)
+		midiinstr[i] = i % synth_num_instruments();
+	midiinstr[9] = PATCH_DRUMS; // gm drum channel to the sampled kit
 }
 
-static int seqtime, seqenabled;
+static void midi_noteon(int instr, int note, int vel) {
+	synth_note_on(note, instr, vel / 127.0);
+	if (seqenabled)
+		seq_add_event2(seqtime, instr, SEQ_EVTYPE_KEYON, note, vel);
+}
 
-void USART2_IRQHandler(void) {
-	static int channum, chanstate, note, notevel;
-	if (USART_GetITStatus(USART2, USART_IT_RXNE)) {
-		int t = USART2->DR;
-#if 1
-		if (isdigit(t)) {
-			channum = t - '0';
-		} else if (isupper(t)) {
-			synth_note_on(t - 'A' + 42, channum, 1.0);
-			if (seqenabled)
-				seq_add_event2(seqtime, channum, SEQ_EVTYPE_KEYON, t - 'A' + 42, 1.0);
-			dodump = 1;
-		} else if (islower(t)) {
-			synth_note_off(t - 'a' + 42, channum);
-			if (seqenabled)
-				seq_add_event(seqtime, channum, SEQ_EVTYPE_KEYOFF, t - 'a' + 42);
-			dodump = 1;
-		} else if (t == ' ') {
-			seqenabled = !seqenabled;
+static void midi_noteoff(int instr, int note) {
+	synth_note_off(note, instr);
+	if (seqenabled)
+		seq_add_event(seqtime, instr, SEQ_EVTYPE_KEYOFF, note);
+}
+
+static void midi_cc(int instr, int cc, int val) {
+	switch (cc) {
+	case MIDI_CC_ALLSOUNDOFF:
+		synth_kill();
+		break;
+	case MIDI_CC_RESETCTRL:
+		synth_pitchbend(instr, 0);
+		break;
+	case MIDI_CC_ALLNOTESOFF:
+		synth_notes_off(instr);
+		break;
+	}
+}
+
+static void midi_realtime(int status) {
+	switch (status) {
+	case MIDI_START:
+		seqtime = 0;
+		// fallthrough
+	case MIDI_CONTINUE:
+		midiclocks = 0;
+		beatclocks = 0;
+		lastbeat = 0;
+		extclock = 1;
+		seqenabled = 1;
+		break;
+	case MIDI_STOP:
+		seqenabled = 0;
+		extclock = 0;
+		break;
+	case MIDI_CLOCK:
+		// the delay follows the tempo measured over each quarter
+		if (++beatclocks == 24) {
+			beatclocks = 0;
+			if (lastbeat)
+				fx_delay_tempo(60000.0 / (msticks - lastbeat), FX_DELAY_BEATS);
+			lastbeat = msticks;
 		}
-#else
-		if (t & 0x80) {
-			channum = t & 0xf;
-			chanstate = t & 0x40;
-		} else if ((t & 0x40) && (t & 0x20)) {
-			note = (t & 0xf) << 4;
-		} else if ((t & 0x40) && (t & 0x10)) {
-			note |= (t & 0xf);
-		} else if (t & 0x20) {
-			notevel = (t & 0xf) << 4;
-		} else if (t & 0x10) {
-			notevel |= (t & 0xf);
-			if (chanstate)
-				synth_note_on(note,channum,notevel / 127.0);
-			else
-				synth_note_off(note,channum);
+		// 24 clocks per quarter, the sequencer steps in 16ths
+		if (extclock && seqenabled && ++midiclocks == 6) {
+			midiclocks = 0;
+			seqtime++;
+			seqplay(seqtime);
 		}
-#endif
+		break;
+	}
+}
+
+static void midi_handle(const struct midimsg *msg) {
+	int instr = midiinstr[MIDI_CHANNEL(msg)];
+
+	switch (MIDI_TYPE(msg)) {
+	case MIDI_NOTEON:
+		if (msg->data[1])
+			midi_noteon(instr, msg->data[0], msg->data[1]);
+		else
+			midi_noteoff(instr, msg->data[0]);
+		break;
+	case MIDI_NOTEOFF:
+		midi_noteoff(instr, msg->data[0]);
+		break;
+	case MIDI_CC:
+		midi_cc(instr, msg->data[0], msg->data[1]);
+		break;
+	case MIDI_PROGRAM:
+		if (msg->data[0] < synth_num_instruments())
+			midiinstr[MIDI_CHANNEL(msg)] = msg->data[0];
+		break;
+	case MIDI_PITCHBEND:
+		// +-2 semitones
+		synth_pitchbend(instr, MIDI_BEND(msg) * (2 / 8192.0));
+		break;
+	case 0xf0:
+		midi_realtime(msg->status);
+		break;
+	}
+}
+
+static void midi_poll(void) {
+	struct midimsg msg;
+	int c;
+	telemetry_rxdepth(uart_rxpending());
+	while ((c = uart_getc()) >= 0) {
+		if (midi_parse(&midiin, c, &msg))
+			midi_handle(&msg);
 	}
 }
 
@@ -251,7 +447,7 @@ void seqplay(int tick) {
 		switch (ev->type) {
 		case SEQ_EVTYPE_KEYON:
 			//printf("on  %d %d\r\n", ev->param1, ev->instrument);
-			synth_note_on(ev->param1, ev->instrument, ev->param2);
+			synth_note_on(ev->param1, ev->instrument, ev->param2 / 127.0);
 			break;
 		case SEQ_EVTYPE_KEYOFF:
 			//printf("off %d %d\r\n", ev->param1, ev->instrument);
@@ -268,21 +464,27 @@ void seqplay(int tick) {
  */
 void timing_handler() {
 	extern __IO uint32_t TimingDelay;
-	static int prescale, pre2, tik;
+	static int prescale, pre2, tik, telemetrytick;
+	msticks++;
+	if (++telemetrytick == TELEMETRY_PERIOD_MS) {
+		telemetrytick = 0;
+		dotelemetry = 1;
+	}
 	if (prescale++ == 1000/16) {
 		prescale = 0;
 		if (pre2++ == 16) {
 			pre2 = 0;
-			printf("ping %d\r\n", tik);
-			if (++tik == 8) {
+			uint32_t ping[2] = { tik, uart_txdrops };
+			log_record(LOG_REC_PING, ping, sizeof(ping));
+			if (++tik == 8)
 				tik = 0;
-				printf("******** RESTART *********\r\n");
-			}
 		}
 
-		seqtime++;
-		if (seqenabled)
-			seqplay(seqtime);
+		if (!extclock) {
+			seqtime++;
+			if (seqenabled)
+				seqplay(seqtime);
+		}
 	}
 	if(TimingDelay)TimingDelay--;
 	if (time_var1) {
@@ -0,0 +1,72 @@
+#include "midi.h"
+
+static int datalen(uint8_t status) {
+	switch (status & 0xf0) {
+	case MIDI_PROGRAM:
+	case MIDI_CHANPRESSURE:
+		return 1;
+	case 0xf0:
+		if (status == 0xf2) // song position
+			return 2;
+		if (status == 0xf1 || status == 0xf3) // timecode, song select
+			return 1;
+		return 0;
+	default:
+		return 2;
+	}
+}
+
+void midi_init(struct midiparser *p) {
+	p->status = 0;
+	p->ndata = 0;
+	p->sysex = 0;
+}
+
+/*
+ * Feed one received byte. Returns 1 and fills msg when it completes a
+ * message. Data bytes of an incomplete message keep waiting across any
+ * realtime bytes that come in between.
+ */
+int midi_parse(struct midiparser *p, uint8_t byte, struct midimsg *msg) {
+	if (byte >= 0xf8) {
+		msg->status = byte;
+		msg->data[0] = msg->data[1] = 0;
+		return 1;
+	}
+
+	if (byte & 0x80) {
+		p->ndata = 0;
+		p->sysex = byte == MIDI_SYSEX;
+		if (byte < 0xf0) {
+			p->status = byte;
+			return 0;
+		}
+		// system common cancels running status
+		p->status = 0;
+		if (byte == MIDI_SYSEX || byte == MIDI_SYSEXEND)
+			return 0;
+		if (datalen(byte)) {
+			p->status = byte;
+			return 0;
+		}
+		msg->status = byte;
+		msg->data[0] = msg->data[1] = 0;
+		return 1;
+	}
+
+	if (p->sysex || !p->status)
+		return 0;
+
+	p->data[p->ndata++] = byte;
+	int n = datalen(p->status);
+	if (p->ndata < n)
+		return 0;
+
+	msg->status = p->status;
+	msg->data[0] = p->data[0];
+	msg->data[1] = n > 1 ? p->data[1] : 0;
+	p->ndata = 0;
+	if (p->status >= 0xf0)
+		p->status = 0;
+	return 1;
+}
@@ -0,0 +1,46 @@
+#ifndef MIDI_H
+#define MIDI_H
+
+#include <stdint.h>
+
+// MIDI 1.0 byte stream parser: running status, system common and realtime
+// messages; sysex contents are skipped.
+
+#define MIDI_NOTEOFF 0x80
+#define MIDI_NOTEON 0x90
+#define MIDI_POLYPRESSURE 0xa0
+#define MIDI_CC 0xb0
+#define MIDI_PROGRAM 0xc0
+#define MIDI_CHANPRESSURE 0xd0
+#define MIDI_PITCHBEND 0xe0
+#define MIDI_SYSEX 0xf0
+#define MIDI_SYSEXEND 0xf7
+#define MIDI_CLOCK 0xf8
+#define MIDI_START 0xfa
+#define MIDI_CONTINUE 0xfb
+#define MIDI_STOP 0xfc
+
+#define MIDI_CC_ALLSOUNDOFF 120
+#define MIDI_CC_RESETCTRL 121
+#define MIDI_CC_ALLNOTESOFF 123
+
+#define MIDI_TYPE(msg) ((msg)->status & 0xf0)
+#define MIDI_CHANNEL(msg) ((msg)->status & 0x0f)
+#define MIDI_BEND(msg) ((((msg)->data[1] << 7) | (msg)->data[0]) - 8192)
+
+struct midimsg {
+	uint8_t status;
+	uint8_t data[2];
+};
+
+struct midiparser {
+	uint8_t status; // running status or pending system common, 0 if none
+	uint8_t data[2];
+	uint8_t ndata;
+	uint8_t sysex;
+};
+
+void midi_init(struct midiparser *p);
+int midi_parse(struct midiparser *p, uint8_t byte, struct midimsg *msg);
+
+#endif
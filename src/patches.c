@@ -0,0 +1,1162 @@
+// Generated from patches.json by gen_coefs.py, do not edit.
+
+#define INSTRUMENT_KINDS(X) \
+	X(DPW_LP, osc_dpw_start, osc_dpw_eval, filt_lp_start, filt_lp_eval) \
+	X(NOISE_HP, osc_noise_start, osc_noise_eval, filt_hp_start, filt_hp_eval) \
+	X(PULSE_NONE, osc_pulse_start, pls_dpw_eval, filt_none_start, filt_none_eval) \
+	X(PULSE_LP, osc_pulse_start, pls_dpw_eval, filt_lp_start, filt_lp_eval) \
+	X(DPW_TEJEEZ, osc_dpw_start, osc_dpw_eval, filt_tejeez_start, filt_tejeez_eval) \
+	X(UNISON_LP, osc_unison_start, osc_unison_eval, filt_lp_start, filt_lp_eval) \
+	X(SAMPLE_NONE, osc_sample_start, osc_sample_eval, filt_none_start, filt_none_eval) \
+	X(FM_NONE, osc_fm_start, osc_fm_eval, filt_none_start, filt_none_eval) \
+	X(PINK_LP, osc_noise_start, osc_pink_eval, filt_lp_start, filt_lp_eval)
+
+enum { INSTRUMENT_KINDS(KIND_ENUM) };
+
+// pot 0 opens the filter by six octaves: 78..5000 Hz
+static const ModRoute bass_routes[] = {
+	{ MOD_SRC_POT(0), MOD_SRC_ONE, MOD_DST_CUTOFF, 6 },
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_bass = {
+	.kind = INSTR_DPW_LP,
+	.adsrtimes = { 0.0459375, 0.459375, 0.6, 0.009177184 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.cutoff = 78,
+	.oversample = 2,
+	.routes = bass_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0.5, 0, 0.05 } },
+};
+
+// pot 0 moves the highpass 125..8000 Hz
+static const ModRoute noise_routes[] = {
+	{ MOD_SRC_POT(0), MOD_SRC_ONE, MOD_DST_CUTOFF, 6 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_noise = {
+	.kind = INSTR_NOISE_HP,
+	.adsrtimes = { 0.0001, 0.3, 0, 0.3 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.cutoff = 125,
+	.pan = 0.3,
+	.routes = noise_routes,
+	.bus = { INSERT_CRUSH, 10, 2, 1, { 0, 0.2, 0.25 } },
+};
+
+// pot 0 sets the width, the envelope sweeps it slowly on top
+static const ModRoute pulsebass_routes[] = {
+	{ MOD_SRC_POT(0), MOD_SRC_ONE, MOD_DST_DUTY, 1 },
+	{ MOD_SRC_ENV, MOD_SRC_ONE, MOD_DST_DUTY, 0.9 },
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_pulsebass = {
+	.kind = INSTR_PULSE_NONE,
+	.adsrtimes = { 0.1, 0.1, 0.5, 0.1 },
+	.modenvtimes = { 3, 0, 1, 0 },
+	.cutoff = 5000,
+	.pan = -0.2,
+	.spread = 0.3,
+	.routes = pulsebass_routes,
+	.bus = { INSERT_FILTER, 3000, 0.2, 1, { 0, 0.25, 0.15 } },
+};
+
+// pot 0 is vibrato depth up to a semitone, pot 1 its rate 8..15 Hz
+static const ModRoute vibrato_routes[] = {
+	{ MOD_SRC_LFO, MOD_SRC_POT(0), MOD_DST_PITCH, 1 },
+	{ MOD_SRC_POT(1), MOD_SRC_ONE, MOD_DST_LFORATE, 0.83 },
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_vibrato = {
+	.kind = INSTR_PULSE_LP,
+	.adsrtimes = { 0.1, 0.1, 0.5, 0.1 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.cutoff = 1000,
+	.duty = 0.5,
+	.lforate = 8.18,
+	.pan = 0.2,
+	.spread = 0.5,
+	.routes = vibrato_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0, 0.35, 0.3 } },
+};
+
+// pot 1 opens the filter by six octaves: 125..8000 Hz, oversampled for the clipper
+static const ModRoute tejeez_routes[] = {
+	{ MOD_SRC_POT(1), MOD_SRC_ONE, MOD_DST_CUTOFF, 6 },
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_tejeez = {
+	.kind = INSTR_DPW_TEJEEZ,
+	.adsrtimes = { 0.0459375, 0.459375, 0.6, 0.009177184 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.cutoff = 125,
+	.oversample = 4,
+	.routes = tejeez_routes,
+	.bus = { INSERT_DIST, 3, 0, 0.8, { 0.5, 0, 0.1 } },
+};
+
+// pot 1 opens the filter by five octaves: 250..8000 Hz
+static const ModRoute supersaw_routes[] = {
+	{ MOD_SRC_POT(1), MOD_SRC_ONE, MOD_DST_CUTOFF, 5 },
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_supersaw = {
+	.kind = INSTR_UNISON_LP,
+	.adsrtimes = { 0.1, 0.1, 0.7, 0.1 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.cutoff = 250,
+	.spread = 0.5,
+	.lanes = 7,
+	.detune = 0.2,
+	.routes = supersaw_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0.3, 0.2, 0.35 } },
+};
+
+// ../samples/kick.wav, 9600 frames at 24000 Hz, adpcm
+static const uint8_t drums_zone0[] = {
+	0x70, 0x77, 0x77, 0x77, 0x32, 0x32, 0x34, 0x44, 0x33, 0x34, 0x34, 0x43, 0x04, 0x11, 0x10, 0x11,
+	0x01, 0x01, 0x01, 0x00, 0x08, 0x99, 0xa9, 0xcb, 0xbc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xbc,
+	0xcb, 0xbb, 0xcc, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xbb, 0xad, 0xbb, 0xbc, 0xbb,
+	0xcb, 0xcb, 0xba, 0xbb, 0xac, 0xbb, 0xcb, 0xba, 0xab, 0xbb, 0xbb, 0xab, 0xab, 0x9b, 0x99, 0x00,
+	0x31, 0x54, 0x53, 0x34, 0x44, 0x43, 0x34, 0x43, 0x34, 0x34, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34,
+	0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x24, 0x24, 0x33, 0x43, 0x33, 0x43, 0x33,
+	0x24, 0x33, 0x24, 0x33, 0x33, 0x43, 0x23, 0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0xa8, 0xca,
+	0xdc, 0xdb, 0xcb, 0xbc, 0xbc, 0xbd, 0xcb, 0xcb, 0xac, 0xbc, 0xbb, 0xcc, 0xbb, 0xbc, 0xcb, 0xac,
+	0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xbb, 0xbc, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0x99,
+	0x08, 0x31, 0x44, 0x35, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x25, 0x24, 0x43,
+	0x33, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x24, 0x24, 0x33, 0x24,
+	0x43, 0x32, 0x24, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x43, 0x32, 0x33, 0x33,
+	0x43, 0x32, 0x32, 0x32, 0x22, 0x21, 0x10, 0x88, 0xaa, 0xdc, 0xcb, 0xcc, 0xdb, 0xbb, 0xbd, 0xbc,
+	0xdb, 0xbb, 0xcc, 0xca, 0xca, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xcb, 0xcb, 0xba, 0xbc, 0xca, 0xba, 0xcb, 0xbb, 0xbb, 0xcc, 0xba,
+	0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xba, 0xab,
+	0xaa, 0x9a, 0x88, 0x11, 0x43, 0x35, 0x45, 0x43, 0x34, 0x34, 0x35, 0x43, 0x53, 0x42, 0x42, 0x32,
+	0x34, 0x43, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x34, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x24, 0x24, 0x33, 0x24, 0x43, 0x32, 0x24, 0x33, 0x43, 0x33,
+	0x43, 0x33, 0x24, 0x33, 0x34, 0x42, 0x32, 0x32, 0x43, 0x32, 0x33, 0x33, 0x33, 0x34, 0x32, 0x32,
+	0x22, 0x12, 0x11, 0x80, 0xa9, 0xdb, 0xcc, 0xbc, 0xbd, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xbc, 0xcb,
+	0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbc, 0xbb, 0xcc, 0xba, 0xbc, 0xbb,
+	0xbc, 0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xac, 0xcb, 0xba,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xbc, 0xca, 0xba, 0xba, 0xcb, 0xba,
+	0xbb, 0xbb, 0xac, 0xab, 0xbb, 0xba, 0xba, 0x9a, 0x9a, 0x08, 0x20, 0x43, 0x54, 0x53, 0x43, 0x34,
+	0x34, 0x44, 0x33, 0x44, 0x33, 0x25, 0x24, 0x24, 0x43, 0x33, 0x34, 0x43, 0x24, 0x24, 0x33, 0x34,
+	0x34, 0x33, 0x25, 0x24, 0x33, 0x53, 0x32, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x43, 0x43, 0x32,
+	0x34, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x34, 0x24, 0x43, 0x32,
+	0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x33, 0x24, 0x33, 0x43, 0x32, 0x23, 0x43, 0x22,
+	0x23, 0x22, 0x23, 0x21, 0x11, 0x80, 0x98, 0xcb, 0xcc, 0xdb, 0xbc, 0xbc, 0xbd, 0xdb, 0xbb, 0xcc,
+	0xbb, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbc, 0xbb, 0xcc, 0xbb, 0xdb, 0xbb, 0xcb, 0xcb, 0xcb, 0xca,
+	0xba, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xdb, 0xba, 0xac,
+	0xcb, 0xba, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xbb, 0xbc, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xcb, 0xab, 0xac, 0xbb, 0xca, 0xba, 0xab, 0xcb, 0xba,
+	0xba, 0xbb, 0xba, 0xbb, 0xba, 0xaa, 0x99, 0x08, 0x20, 0x63, 0x53, 0x53, 0x43, 0x34, 0x34, 0x34,
+	0x35, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x44, 0x42, 0x32, 0x24, 0x24, 0x43, 0x33, 0x43, 0x24,
+	0x24, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x24, 0x33,
+	0x34, 0x33, 0x34, 0x34, 0x33, 0x44, 0x32, 0x33, 0x34, 0x34, 0x42, 0x23, 0x24, 0x43, 0x32, 0x33,
+	0x34, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x24, 0x33,
+	0x24, 0x33, 0x43, 0x32, 0x33, 0x24, 0x33, 0x33, 0x33, 0x43, 0x22, 0x23, 0x22, 0x12, 0x11, 0x88,
+	0xa9, 0xbc, 0xbe, 0xcc, 0xcb, 0xbc, 0xcc, 0xcb, 0xbb, 0xbd, 0xcb, 0xac, 0xbc, 0xbb, 0xbd, 0xcb,
+	0xbb, 0xad, 0xac, 0xcb, 0xca, 0xba, 0xac, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+	0xbc, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb,
+	0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xca, 0xba, 0xbb, 0xcb, 0xac, 0xbb, 0xcb,
+	0xbb, 0xac, 0xac, 0xbb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xca, 0xba, 0xba, 0xac, 0xbb,
+	0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xab, 0xbb, 0xbb, 0xaa, 0x99, 0x09, 0x11, 0x34, 0x36,
+	0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x34,
+	0x43, 0x33, 0x44, 0x42, 0x32, 0x43, 0x43, 0x33, 0x43, 0x24, 0x43, 0x33, 0x43, 0x24, 0x43, 0x32,
+	0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x33, 0x25, 0x43, 0x23, 0x34, 0x33, 0x34, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33,
+	0x34, 0x33, 0x34, 0x24, 0x33, 0x34, 0x33, 0x43, 0x43, 0x23, 0x24, 0x33, 0x33, 0x34, 0x43, 0x32,
+	0x43, 0x32, 0x33, 0x43, 0x33, 0x33, 0x43, 0x32, 0x33, 0x33, 0x32, 0x33, 0x23, 0x22, 0x01, 0x98,
+	0xba, 0xbe, 0xcd, 0xdb, 0xcb, 0xcb, 0xbc, 0xdb, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc,
+	0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xdb,
+	0xba, 0xac, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb,
+	0xad, 0xbb, 0xac, 0xac, 0xbb, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbc, 0xbc, 0xca,
+	0xba, 0xbb, 0xcb, 0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xac, 0xbb,
+	0xab, 0xbb, 0xba, 0xaa, 0xaa, 0x98, 0x10, 0x42, 0x53, 0x35, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34,
+	0x25, 0x24, 0x43, 0x43, 0x33, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x34, 0x34, 0x33, 0x25,
+	0x24, 0x33, 0x34, 0x43, 0x43, 0x33, 0x53, 0x32, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x43,
+	0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x33,
+	0x34, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x25, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x24,
+	0x24, 0x33, 0x33, 0x44, 0x32, 0x33, 0x24, 0x24, 0x33, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x33,
+	0x34, 0x43, 0x33, 0x33, 0x43, 0x33, 0x43, 0x32, 0x33, 0x43, 0x32, 0x22, 0x23, 0x23, 0x22, 0x11,
+	0x01, 0x99, 0xcb, 0xcc, 0xbc, 0xbd, 0xcc, 0xcb, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xac, 0xbc, 0xbb,
+	0xbd, 0xcb, 0xbb, 0xad, 0xac, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc,
+	0xac, 0xac, 0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb,
+	0xbb, 0xcb, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xca,
+	0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xcb, 0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc,
+	0xcb, 0xba, 0xac, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xba, 0xcb,
+	0xba, 0xbb, 0xac, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xac, 0xba, 0xaa, 0xaa, 0xaa, 0x99, 0x09, 0x20,
+	0x52, 0x43, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x34, 0x43, 0x43, 0x24, 0x24, 0x43, 0x43, 0x42,
+	0x33, 0x43, 0x24, 0x24, 0x43, 0x33, 0x53, 0x42, 0x32, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x42,
+	0x32, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33,
+	0x34, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x32,
+	0x34, 0x42, 0x23, 0x24, 0x33, 0x34, 0x33, 0x34, 0x24, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x34,
+	0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x43, 0x32, 0x24, 0x33, 0x33,
+	0x43, 0x43, 0x32, 0x32, 0x24, 0x23, 0x33, 0x24, 0x32, 0x32, 0x32, 0x32, 0x22, 0x12, 0x01, 0x90,
+	0xba, 0xcc, 0xbd, 0xbd, 0xcc, 0xcb, 0xcb, 0xbc, 0xdb, 0xca, 0xbb, 0xbc, 0xbc, 0xbc, 0xdb, 0xca,
+	0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xad, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xbb,
+	0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc,
+	0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xbb, 0xbc,
+	0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xac, 0xab, 0xbb, 0xbb, 0xbb, 0xac, 0xaa, 0xa9,
+	0x89, 0x08, 0x21, 0x42, 0x35, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x43,
+	0x43, 0x33, 0x34, 0x34, 0x43, 0x24, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x53, 0x42, 0x32,
+	0x43, 0x33, 0x34, 0x34, 0x33, 0x44, 0x32, 0x34, 0x33, 0x34, 0x34, 0x33, 0x25, 0x43, 0x32, 0x34,
+	0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x33, 0x44, 0x32, 0x43, 0x33, 0x43, 0x43,
+	0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43,
+	0x33, 0x43, 0x43, 0x32, 0x24, 0x33, 0x34, 0x33, 0x53, 0x32, 0x33, 0x34, 0x43, 0x32, 0x24, 0x33,
+	0x43, 0x33, 0x43, 0x33, 0x33, 0x34, 0x43, 0x23, 0x24, 0x32, 0x33, 0x43, 0x32, 0x33, 0x33, 0x24,
+	0x32, 0x22, 0x22, 0x12, 0x11, 0x90, 0xa9, 0xeb, 0xdb, 0xcb, 0xbc, 0xbd, 0xdb, 0xbb, 0xbd, 0xcb,
+	0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xad, 0xac, 0xcb, 0xca, 0xca, 0xba, 0xcb, 0xcb, 0xbb, 0xdb, 0xbb,
+	0xcb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xca, 0xba, 0xcb, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xac, 0xbb, 0xbc, 0xcb, 0xbb,
+	0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xca, 0xba, 0xcb,
+	0xbb, 0xcb, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xcb, 0xba,
+	0xac, 0xbb, 0xbc, 0xca, 0xba, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xac, 0xab,
+	0xbb, 0xac, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xaa, 0x99, 0x18, 0x31, 0x35, 0x35, 0x44, 0x53,
+	0x43, 0x43, 0x43, 0x34, 0x43, 0x43, 0x34, 0x43, 0x43, 0x33, 0x25, 0x24, 0x43, 0x33, 0x53, 0x33,
+	0x53, 0x42, 0x32, 0x24, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43,
+	0x33, 0x34, 0x34, 0x33, 0x25, 0x43, 0x32, 0x34, 0x33, 0x34, 0x43, 0x43, 0x33, 0x24, 0x24, 0x33,
+	0x34, 0x43, 0x33, 0x34, 0x33, 0x44, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34,
+	0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x25, 0x33, 0x24, 0x43, 0x32,
+	0x43, 0x33, 0x43, 0x33, 0x24, 0x43, 0x32, 0x43, 0x33, 0x33, 0x34, 0x43, 0x33, 0x33, 0x34, 0x24,
+	0x33, 0x33, 0x34, 0x33, 0x34, 0x32, 0x24, 0x23, 0x33, 0x33, 0x33, 0x24, 0x32, 0x12, 0x12, 0x01,
+	0x98, 0xb9, 0xbd, 0xcc, 0xdb, 0xdb, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb,
+	0xbb, 0xcc, 0xca, 0xba, 0xcb, 0xcb, 0xcb, 0xca, 0xba, 0xac, 0xac, 0xbb, 0xbc, 0xbc, 0xbb, 0xcc,
+	0xba, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xbb,
+	0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb,
+	0xac, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xcc, 0xba, 0xbb,
+	0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbc, 0xba, 0xac, 0xbb, 0xbb, 0xcb, 0xba, 0xbb,
+	0xbb, 0xac, 0xba, 0x9a, 0xaa, 0x99, 0x00, 0x20, 0x53, 0x43, 0x53, 0x43, 0x34, 0x34, 0x35, 0x43,
+	0x53, 0x33, 0x53, 0x33, 0x44, 0x42, 0x32, 0x34, 0x43, 0x43, 0x33, 0x34, 0x34, 0x24, 0x24, 0x43,
+	0x33, 0x43, 0x24, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x32, 0x34, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x34, 0x33, 0x25, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43,
+	0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x53, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34, 0x24, 0x43,
+	0x33, 0x33, 0x25, 0x33, 0x34, 0x33, 0x34, 0x24, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33,
+	0x34, 0x43, 0x42, 0x32, 0x42, 0x32, 0x33, 0x43, 0x43, 0x32, 0x33, 0x34, 0x33, 0x24, 0x43, 0x32,
+	0x33, 0x33, 0x34, 0x33, 0x43, 0x23, 0x33, 0x33, 0x24, 0x22, 0x22, 0x12, 0x11, 0x88, 0xb9, 0xdb,
+	0xcb, 0xcb, 0xbc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc,
+	0xbc, 0xcb, 0xcb, 0xcb, 0xca, 0xba, 0xbc, 0xbb, 0xcc, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xac, 0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+	0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb,
+	0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xcb, 0xca, 0xba, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xac, 0xba,
+	0xaa, 0xab, 0xa9, 0x99, 0x90, 0x31, 0x33, 0x35, 0x34, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34,
+	0x44, 0x32, 0x34, 0x34, 0x43, 0x43, 0x33, 0x25, 0x43, 0x33, 0x34, 0x53, 0x32, 0x34, 0x33, 0x25,
+	0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x24, 0x43,
+	0x33, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x43, 0x32, 0x34, 0x33,
+	0x34, 0x43, 0x33, 0x34, 0x24, 0x43, 0x33, 0x33, 0x25, 0x43, 0x32, 0x43, 0x33, 0x24, 0x24, 0x33,
+	0x43, 0x33, 0x34, 0x43, 0x42, 0x32, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x32, 0x24,
+	0x43, 0x32, 0x33, 0x34, 0x33, 0x34, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x43, 0x23, 0x43, 0x32,
+	0x33, 0x43, 0x23, 0x33, 0x24, 0x23, 0x33, 0x22, 0x23, 0x23, 0x11, 0x11, 0x90, 0xbb, 0xdb, 0xbb,
+	0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xdb, 0xbb, 0xbc, 0xdb, 0xbb, 0xbc, 0xbc, 0xdb, 0xca, 0xba, 0xbc,
+	0xbb, 0xad, 0xac, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbc,
+	0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+	0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xcb,
+	0xbb, 0xcb, 0xcb, 0xbb, 0xbb, 0xcc, 0xba, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xbc,
+	0xba, 0xac, 0xbb, 0xbc, 0xba, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xba, 0xbb,
+	0xbb, 0xba, 0x9a, 0x09, 0x21, 0x33, 0x53, 0x43, 0x33, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+	0x43, 0x33, 0x34, 0x44, 0x32, 0x34, 0x43, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24,
+	0x24, 0x43, 0x33, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x44, 0x32, 0x24, 0x43, 0x33, 0x43, 0x43,
+	0x33, 0x53, 0x32, 0x24, 0x43, 0x33, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x43, 0x43, 0x33, 0x43,
+	0x43, 0x33, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x43, 0x33, 0x34, 0x43, 0x42, 0x32, 0x43, 0x33,
+	0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x43, 0x32, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x24,
+	0x43, 0x32, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43,
+	0x23, 0x43, 0x23, 0x33, 0x33, 0x33, 0x33, 0x24, 0x22, 0x11, 0x11, 0x91, 0xb9, 0xbb, 0xbc, 0xbc,
+	0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc, 0xdb, 0xbb, 0xdb, 0xbb, 0xdb,
+	0xba, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc,
+	0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xca, 0xba, 0xcb, 0xba, 0xbc, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xcb, 0xcb, 0xba, 0xcb, 0xbb, 0xac, 0xcb,
+	0xab, 0xac, 0xbb, 0xbc, 0xca, 0xba, 0xcb, 0xbb, 0xbb, 0xbc, 0xbc, 0xca, 0xba, 0xbb, 0xbc, 0xbb,
+	0xcb, 0xcb, 0xba, 0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xac, 0xab, 0xab,
+	0xaa, 0xb9, 0x99, 0x11, 0x31, 0x33, 0x34, 0x53, 0x34, 0x43, 0x34, 0x34, 0x34, 0x25, 0x43, 0x43,
+	0x33, 0x35, 0x33, 0x44, 0x33, 0x53, 0x33, 0x34, 0x43, 0x24, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33,
+	0x34, 0x24, 0x24, 0x43, 0x32, 0x34, 0x33, 0x25, 0x43, 0x42, 0x32, 0x33, 0x34, 0x34, 0x43, 0x33,
+	0x34, 0x43, 0x43, 0x33, 0x43, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33, 0x34, 0x33, 0x25,
+	0x33, 0x34, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43, 0x33, 0x34, 0x34, 0x42, 0x32, 0x24, 0x43, 0x32,
+	0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x42, 0x23, 0x24, 0x33, 0x43, 0x33, 0x34, 0x33,
+	0x34, 0x33, 0x34, 0x24, 0x33, 0x24, 0x33, 0x24, 0x43, 0x32, 0x33, 0x43, 0x32, 0x24, 0x33, 0x33,
+	0x24, 0x33, 0x43, 0x32, 0x22, 0x33, 0x23, 0x23, 0x33, 0x21, 0x11, 0x99, 0xaa, 0xbb, 0xdb, 0xbb,
+	0xbc, 0xbd, 0xdb, 0xbb, 0xbc, 0xcc, 0xbb, 0xbc, 0xad, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xca, 0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xdb, 0xba,
+	0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xac, 0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+	0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xbb,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xac, 0xab, 0xab, 0xbb, 0xbb, 0xbb, 0xbb,
+	0xbb, 0x9b, 0x09, 0x11, 0x31, 0x33, 0x53, 0x33, 0x53, 0x42, 0x43, 0x34, 0x43, 0x43, 0x43, 0x53,
+	0x32, 0x24, 0x34, 0x33, 0x25, 0x24, 0x43, 0x33, 0x53, 0x33, 0x43, 0x43, 0x43, 0x33, 0x34, 0x43,
+	0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43, 0x43, 0x42, 0x32, 0x43, 0x33, 0x34, 0x43, 0x43,
+	0x33, 0x43, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x53, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34,
+	0x33, 0x25, 0x33, 0x24, 0x43, 0x32, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x24, 0x33, 0x34,
+	0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x32, 0x24, 0x33, 0x24, 0x33, 0x43, 0x32, 0x43, 0x32,
+	0x33, 0x33, 0x24, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x21, 0x00, 0x99, 0xb9, 0xbb, 0xcb, 0xbb,
+	0xbd, 0xac, 0xbc, 0xbc, 0xbd, 0xbb, 0xcc, 0xbb, 0xbd, 0xbb, 0xbd, 0xbb, 0xbd, 0xcb, 0xbb, 0xbc,
+	0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+	0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xcb, 0xba,
+	0xac, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xac,
+	0xbb, 0xbc, 0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xba, 0xac,
+	0xbb, 0xbb, 0xbc, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0xab, 0xba,
+	0x9a, 0x9a, 0x09, 0x11, 0x12, 0x33, 0x43, 0x33, 0x63, 0x23, 0x34, 0x43, 0x34, 0x43, 0x53, 0x33,
+	0x34, 0x53, 0x33, 0x34, 0x43, 0x24, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x53, 0x33, 0x43,
+	0x24, 0x43, 0x33, 0x53, 0x32, 0x24, 0x43, 0x33, 0x43, 0x24, 0x43, 0x32, 0x34, 0x33, 0x34, 0x34,
+	0x33, 0x44, 0x32, 0x24, 0x43, 0x32, 0x24, 0x24, 0x33, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x24,
+	0x43, 0x33, 0x43, 0x33, 0x34, 0x24, 0x43, 0x32, 0x24, 0x43, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33,
+	0x43, 0x33, 0x43, 0x24, 0x33, 0x43, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x43,
+	0x33, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x24, 0x24, 0x32, 0x43, 0x23, 0x33, 0x34, 0x33, 0x33,
+	0x43, 0x33, 0x24, 0x23, 0x33, 0x23, 0x33, 0x33, 0x13, 0x12, 0x00, 0x99, 0xb9, 0xba, 0xbb, 0xbc,
+	0xbb, 0xbe, 0xba, 0xbd, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcc, 0xbb, 0xbc, 0xdb, 0xca, 0xba, 0xcb,
+	0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xac, 0xcb, 0xbb, 0xdb,
+	0xba, 0xac, 0xcb, 0xba, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb,
+	0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc,
+	0xcb, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xba, 0xbc, 0xbb, 0xdb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xad, 0xbb, 0xcb, 0xba, 0xac,
+	0xbb, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xad, 0xb9, 0xa9,
+	0xa9, 0x99, 0x09, 0x11, 0x31, 0x22, 0x33, 0x53, 0x32, 0x33, 0x35, 0x34, 0x34, 0x53, 0x33, 0x34,
+	0x34, 0x34, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x25, 0x43, 0x33, 0x53, 0x32,
+	0x34, 0x33, 0x34, 0x34, 0x24, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43,
+	0x33, 0x34, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x34, 0x33, 0x25, 0x33, 0x34, 0x33, 0x44, 0x32,
+	0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x43, 0x33, 0x53, 0x32, 0x43,
+	0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x43, 0x43, 0x33,
+	0x33, 0x34, 0x24, 0x33, 0x34, 0x42, 0x32, 0x33, 0x34, 0x33, 0x34, 0x33, 0x33, 0x25, 0x23, 0x43,
+	0x22, 0x33, 0x33, 0x33, 0x34, 0x32, 0x33, 0x13, 0x13, 0x11, 0x01, 0x99, 0xa9, 0xaa, 0xbb, 0xbb,
+	0xad, 0xbb, 0xdb, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbd, 0xbb, 0xcc, 0xbb, 0xdb, 0xbb,
+	0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xad,
+	0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+	0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xdb, 0xba, 0xac, 0xbb, 0xac, 0xcb, 0xbb, 0xbb, 0xcc, 0xba, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xab, 0xbc, 0xba, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xba, 0xcb, 0xaa, 0xab, 0xaa,
+	0xa9, 0x99, 0x00, 0x11, 0x21, 0x22, 0x32, 0x33, 0x24, 0x33, 0x26, 0x32, 0x34, 0x43, 0x43, 0x43,
+	0x34, 0x42, 0x33, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x25, 0x33, 0x34, 0x34, 0x33, 0x35, 0x33,
+	0x34, 0x34, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x53, 0x32, 0x34, 0x33,
+	0x34, 0x43, 0x43, 0x33, 0x53, 0x32, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x53, 0x32,
+	0x24, 0x43, 0x32, 0x24, 0x33, 0x34, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33,
+	0x34, 0x33, 0x34, 0x43, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x32, 0x24, 0x43, 0x32,
+	0x33, 0x34, 0x33, 0x34, 0x24, 0x33, 0x43, 0x33, 0x43, 0x33, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43,
+	0x33, 0x33, 0x43, 0x23, 0x33, 0x24, 0x21, 0x12, 0x12, 0x11, 0x91, 0x90, 0xa9, 0xb9, 0xba, 0xbb,
+	0xcb, 0xba, 0xdb, 0xbb, 0xbc, 0xcb, 0xdb, 0xbb, 0xbc, 0xdb, 0xab, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb,
+	0xbc, 0xdb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbd, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc,
+	0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xdb, 0xba, 0xac,
+	0xcb, 0xba, 0xbc, 0xbb, 0xdb, 0xbb, 0xbb, 0xbd, 0xca, 0xba, 0xbc, 0xca, 0xba, 0xac, 0xbb, 0xbc,
+	0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb,
+	0xcb, 0xbb, 0xbb, 0xad, 0xbb, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xac, 0xbb,
+	0xac, 0xbb, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xbb, 0xdb, 0xaa, 0xaa, 0xba, 0xaa, 0x9a,
+	0x9a, 0x99, 0x00, 0x11, 0x11, 0x22, 0x22, 0x33, 0x33, 0x24, 0x33, 0x35, 0x33, 0x34, 0x34, 0x34,
+	0x34, 0x53, 0x42, 0x32, 0x34, 0x33, 0x35, 0x43, 0x43, 0x33, 0x34, 0x53, 0x32, 0x34, 0x33, 0x34,
+	0x34, 0x24, 0x24, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34,
+	0x43, 0x33, 0x53, 0x32, 0x24, 0x43, 0x32, 0x34, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34,
+	0x43, 0x33, 0x34, 0x43, 0x43, 0x32, 0x24, 0x43, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33,
+	0x53, 0x32, 0x24, 0x33, 0x24, 0x43, 0x23, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x25, 0x33, 0x43,
+	0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x43, 0x32, 0x33, 0x43, 0x32, 0x24,
+	0x23, 0x33, 0x43, 0x13, 0x33, 0x33, 0x13, 0x13, 0x12, 0x01, 0x00, 0x90, 0x99, 0xaa, 0xb9, 0xbb,
+	0xbb, 0xbb, 0xad, 0xba, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbd,
+	0xbb, 0xcc, 0xba, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xad, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb,
+	0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xbc, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xab, 0xbc, 0xca, 0xba, 0xcb, 0xbb, 0xcb, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xbb, 0xcb, 0xbb,
+	0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xcb, 0xab, 0xbb, 0xbb, 0xab, 0x9a, 0x9b,
+	0x99, 0x99, 0x09, 0x11, 0x11, 0x31, 0x31, 0x32, 0x32, 0x33, 0x34, 0x32, 0x35, 0x32, 0x34, 0x43,
+	0x43, 0x53, 0x32, 0x34, 0x43, 0x43, 0x42, 0x33, 0x43, 0x43, 0x43, 0x33, 0x53, 0x33, 0x34, 0x43,
+	0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x53, 0x32, 0x24, 0x43, 0x33, 0x43, 0x43, 0x33, 0x53, 0x32,
+	0x24, 0x43, 0x23, 0x34, 0x33, 0x34, 0x24, 0x43, 0x33, 0x53, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33,
+	0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x53, 0x32,
+	0x43, 0x32, 0x24, 0x43, 0x32, 0x43, 0x33, 0x43, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x24, 0x43,
+	0x33, 0x33, 0x34, 0x33, 0x34, 0x43, 0x32, 0x24, 0x33, 0x24, 0x33, 0x43, 0x33, 0x33, 0x24, 0x33,
+	0x53, 0x22, 0x22, 0x32, 0x33, 0x22, 0x12, 0x12, 0x11, 0x11, 0x01, 0x99, 0x99, 0xa9, 0xb9, 0xaa,
+	0xab, 0xbb, 0xcb, 0xba, 0xcb, 0xbb, 0xeb, 0xaa, 0xcb, 0xba, 0xad, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcc, 0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xdb, 0xba, 0xcb, 0xbb, 0xbc,
+	0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xdb, 0xba, 0xcb, 0xbb, 0xcb,
+	0xac, 0xbb, 0xbc, 0xbb, 0xbd, 0xca, 0xba, 0xcb, 0xbb, 0xdb, 0xba, 0xcb, 0xbb, 0xdb, 0xba, 0xcb,
+	0xca, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xdb, 0xba, 0xcb, 0xba, 0xcb, 0xab, 0xac, 0xbb, 0xcb, 0xbb, 0xac,
+	0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xbb, 0xbc, 0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xbb, 0xaa, 0xa9, 0xa9,
+	0x99, 0x09, 0x00, 0x10, 0x11, 0x21, 0x21, 0x22, 0x32, 0x33, 0x33, 0x43, 0x32, 0x43, 0x33, 0x34,
+	0x34, 0x43, 0x43, 0x33, 0x35, 0x33, 0x35, 0x33, 0x25, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x34,
+	0x43, 0x43, 0x43, 0x32, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x43, 0x43, 0x32, 0x34,
+	0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x33, 0x25, 0x43, 0x32, 0x43, 0x43, 0x32, 0x24, 0x33, 0x34,
+	0x43, 0x33, 0x34, 0x24, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43,
+	0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x33, 0x25, 0x33, 0x33, 0x34, 0x33, 0x43, 0x33, 0x53, 0x22,
+	0x22, 0x33, 0x33, 0x33, 0x23, 0x22, 0x21, 0x11, 0x11, 0x11, 0x00, 0x90, 0x99, 0x99, 0x9a, 0xab,
+	0xaa, 0xba, 0xbb, 0xbb, 0xac, 0xbb, 0xdb, 0xab, 0xbb, 0xbd, 0xbb, 0xbc, 0xbc, 0xac, 0xbc, 0xbb,
+	0xbd, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbd, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xac, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xad, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+	0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xac, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb,
+	0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xac, 0xcb, 0xba, 0xbb, 0xac,
+	0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xdb, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9a, 0x9a,
+	0x99, 0x90, 0x00, 0x01, 0x11, 0x11, 0x12, 0x22, 0x31, 0x23, 0x33, 0x33, 0x33, 0x24, 0x33, 0x53,
+	0x23, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x25, 0x43, 0x33, 0x53, 0x33, 0x34, 0x43, 0x43, 0x33,
+	0x53, 0x23, 0x34, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x43, 0x24, 0x43, 0x33, 0x43, 0x43, 0x42,
+	0x32, 0x43, 0x33, 0x34, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x24, 0x43, 0x33, 0x43, 0x43, 0x33,
+	0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x24, 0x24, 0x33, 0x24, 0x43,
+	0x33, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x43, 0x23, 0x43, 0x33, 0x43, 0x43, 0x32,
+	0x43, 0x33, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x24, 0x33, 0x43, 0x23, 0x33, 0x24,
+	0x22, 0x33, 0x33, 0x22, 0x31, 0x21, 0x21, 0x11, 0x11, 0x01, 0x00, 0x90, 0x90, 0x99, 0x9a, 0x9a,
+	0x9b, 0xab, 0xab, 0xbb, 0xbb, 0xcb, 0xaa, 0xcb, 0xab, 0xbc, 0xbb, 0xbd, 0xbb, 0xbc, 0xcb, 0xcb,
+	0xcb, 0xca, 0xab, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xbc,
+	0xbb, 0xbd, 0xbb, 0xdb, 0xbb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+	0xac, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xdb, 0xba, 0xbb,
+	0xdb, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xcb, 0xaa, 0xba, 0xab, 0xab, 0xaa, 0xb9, 0xa9, 0x99, 0x99,
+	0x99, 0x99, 0x00, 0x01, 0x11, 0x11, 0x11, 0x12, 0x13, 0x23, 0x22, 0x33, 0x33, 0x33, 0x33, 0x24,
+	0x33, 0x53, 0x23, 0x23, 0x34, 0x24, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x53, 0x32,
+	0x34, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x34, 0x42, 0x23, 0x34, 0x33, 0x34, 0x34, 0x33,
+	0x35, 0x33, 0x53, 0x33, 0x43, 0x33, 0x34, 0x24, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33
+};
+
+// ../samples/snare.wav, 7200 frames at 24000 Hz, ulaw
+static const uint8_t drums_zone1[] = {
+	0x9b, 0xa8, 0x11, 0x2a, 0x8f, 0x9e, 0xa7, 0x47, 0x9c, 0x9d, 0x9e, 0xe5, 0x98, 0x9a, 0x8d, 0x8a,
+	0x8f, 0xa5, 0x9e, 0x9f, 0xa4, 0x99, 0x88, 0x8e, 0x8d, 0x82, 0x90, 0x8e, 0x9a, 0x9c, 0x8b, 0x91,
+	0x87, 0x80, 0x8d, 0xa2, 0x84, 0x8b, 0x8e, 0x8b, 0x90, 0x8f, 0xa4, 0x87, 0x8c, 0x5f, 0x8c, 0x91,
+	0x9e, 0x98, 0x9a, 0x8c, 0xa8, 0x93, 0xcc, 0x90, 0x99, 0x55, 0xad, 0x98, 0xb4, 0x3e, 0x28, 0x5f,
+	0xa0, 0x1f, 0x9a, 0x1c, 0xa3, 0x19, 0xa9, 0x29, 0x1b, 0x1e, 0x29, 0x1e, 0x11, 0x12, 0x25, 0x69,
+	0x16, 0x07, 0x35, 0x1a, 0x1e, 0x05, 0x1d, 0x05, 0x1e, 0x0b, 0x0c, 0x2d, 0x05, 0x15, 0x1f, 0x06,
+	0x0a, 0x29, 0x0b, 0x16, 0x03, 0x10, 0x0b, 0x20, 0x08, 0x43, 0x04, 0x25, 0x06, 0x12, 0x3b, 0x0a,
+	0x0f, 0x34, 0x14, 0x0d, 0xab, 0x0c, 0x0f, 0x29, 0x58, 0x53, 0x10, 0x29, 0x19, 0xc5, 0xa6, 0xc0,
+	0xaf, 0x4f, 0xbd, 0x4b, 0x2f, 0x2a, 0x9f, 0x5e, 0x42, 0x9d, 0x8f, 0x38, 0x97, 0xa4, 0x9a, 0xb6,
+	0x88, 0xb4, 0x92, 0x9c, 0xb4, 0x8c, 0x9f, 0x9c, 0x98, 0x90, 0x93, 0x86, 0x8d, 0x85, 0x8b, 0x8c,
+	0xbc, 0x95, 0x9a, 0x8b, 0x8d, 0x8b, 0x8f, 0xa4, 0x93, 0x8f, 0xab, 0x9b, 0x8c, 0x9b, 0x88, 0x9e,
+	0xa2, 0x99, 0x98, 0x9a, 0x8f, 0x98, 0xa4, 0x94, 0xbf, 0x8e, 0x96, 0xae, 0x44, 0xbb, 0xaf, 0x21,
+	0xaf, 0xae, 0x2c, 0x2d, 0x9a, 0x2d, 0x50, 0xa9, 0x28, 0x18, 0xad, 0x15, 0x0e, 0xdd, 0x11, 0x1f,
+	0xc8, 0x20, 0x09, 0x1f, 0x1a, 0x1b, 0x0f, 0x21, 0x0b, 0x16, 0x18, 0x3e, 0x07, 0x25, 0x0a, 0x1a,
+	0x0f, 0x13, 0x1d, 0x0d, 0x09, 0x0d, 0x0e, 0x4c, 0x18, 0x24, 0x11, 0x04, 0x1f, 0x1f, 0x19, 0x10,
+	0x0f, 0x18, 0x2d, 0x0e, 0x1e, 0x1c, 0xf1, 0x25, 0x2d, 0x22, 0x0f, 0x17, 0x33, 0x1f, 0x3c, 0xbc,
+	0xac, 0x2e, 0xbe, 0x17, 0x53, 0x96, 0x1e, 0xbb, 0x33, 0xd0, 0x8d, 0x94, 0xb1, 0x2d, 0xac, 0xaa,
+	0x91, 0x97, 0xa5, 0x9b, 0xba, 0x92, 0x8b, 0x96, 0xed, 0x93, 0x8e, 0xa5, 0x8a, 0x9c, 0x8f, 0x9d,
+	0x89, 0x93, 0x9b, 0xae, 0x92, 0xa5, 0x8b, 0x89, 0xab, 0x91, 0x94, 0x98, 0x8e, 0x8c, 0x99, 0xa3,
+	0x8d, 0xb8, 0x93, 0x9b, 0x98, 0x98, 0x47, 0x9b, 0xac, 0x9a, 0x94, 0xb4, 0x22, 0xa5, 0x9c, 0x9d,
+	0xc6, 0xad, 0x18, 0x99, 0xc7, 0x3e, 0xb3, 0xeb, 0x10, 0xb4, 0x48, 0x15, 0xde, 0x29, 0x15, 0xd0,
+	0x11, 0x35, 0x1d, 0x17, 0x2a, 0x1c, 0x12, 0xce, 0x0a, 0x0e, 0x27, 0x39, 0x1a, 0x1c, 0x0f, 0x19,
+	0x0d, 0x0f, 0x1a, 0x0b, 0x10, 0x3c, 0x0e, 0x2a, 0x1f, 0x0e, 0x1b, 0x1d, 0x1d, 0x08, 0x0f, 0x1b,
+	0x1e, 0x16, 0x0f, 0x35, 0xcc, 0x13, 0x1f, 0x1a, 0x20, 0xe3, 0x16, 0x36, 0x23, 0x2c, 0xbb, 0x11,
+	0xae, 0x1f, 0xc8, 0xb7, 0x4c, 0x2c, 0xa7, 0x1d, 0xa7, 0xea, 0xae, 0x9c, 0xa6, 0xb8, 0x48, 0xcb,
+	0xa0, 0xb2, 0xa5, 0x8c, 0x52, 0x8f, 0xaa, 0xa2, 0xa0, 0xab, 0x93, 0xa0, 0x93, 0x9b, 0x8a, 0x8e,
+	0xa6, 0x96, 0x8e, 0xae, 0xad, 0x9a, 0x9a, 0x8c, 0x9a, 0x99, 0x8d, 0xa9, 0x8d, 0x98, 0xa2, 0x8f,
+	0xab, 0x8f, 0x94, 0xae, 0x9c, 0x94, 0xa2, 0xa1, 0x9d, 0x9d, 0xad, 0x9e, 0x2c, 0xa9, 0xa9, 0x58,
+	0xc4, 0x41, 0x95, 0x37, 0xd0, 0xa1, 0x1f, 0x9f, 0x1a, 0x1f, 0x7a, 0x45, 0xa5, 0xda, 0x2e, 0x1b,
+	0x26, 0x19, 0xd1, 0x1a, 0x1a, 0x32, 0x13, 0x1e, 0xcb, 0x0e, 0x15, 0x1a, 0x1c, 0x22, 0x18, 0x1c,
+	0x17, 0x18, 0x2a, 0x16, 0x18, 0x2b, 0x0c, 0x13, 0x4c, 0x15, 0x26, 0x0c, 0x1e, 0x2e, 0x10, 0x28,
+	0x1b, 0x14, 0x45, 0x11, 0x1a, 0x23, 0x17, 0x48, 0x1f, 0x21, 0x21, 0xd6, 0x3d, 0x28, 0x19, 0x1f,
+	0x30, 0x19, 0x29, 0x9a, 0x1d, 0x9f, 0x7e, 0xaf, 0x1a, 0x4e, 0x9e, 0x23, 0x5f, 0xa9, 0xbe, 0xb7,
+	0x97, 0x65, 0x8e, 0xa5, 0x37, 0x90, 0xcb, 0x9f, 0x9c, 0xbc, 0x98, 0xb4, 0x9e, 0x8b, 0x94, 0xa3,
+	0x99, 0x94, 0xdd, 0x99, 0xab, 0xa1, 0x9d, 0x98, 0x9e, 0x97, 0x94, 0x90, 0x8f, 0x93, 0x9d, 0xa7,
+	0x93, 0x6a, 0xb3, 0x8e, 0x9c, 0xbc, 0xa1, 0xa7, 0x9e, 0xa1, 0xa6, 0x97, 0x9e, 0xb7, 0xbd, 0xf6,
+	0x9d, 0x9c, 0x28, 0xaa, 0xb4, 0xc6, 0x1e, 0xb2, 0x2f, 0x3a, 0xb0, 0xbf, 0x57, 0x7c, 0x3c, 0x24,
+	0x17, 0xb9, 0x5c, 0x37, 0x1f, 0x10, 0x1d, 0x1d, 0x63, 0x29, 0x17, 0xc6, 0x35, 0x22, 0x12, 0x12,
+	0x15, 0x3e, 0x20, 0x11, 0x37, 0x18, 0x15, 0x18, 0x27, 0x17, 0x20, 0x0f, 0x2d, 0x14, 0x42, 0x0f,
+	0x1a, 0x25, 0x1c, 0x23, 0x46, 0x10, 0x38, 0x27, 0x2b, 0x1a, 0x1f, 0x1e, 0x2b, 0x1f, 0x22, 0x49,
+	0x24, 0x55, 0x72, 0x2b, 0x29, 0xb5, 0xab, 0x22, 0xbc, 0xbd, 0xab, 0xe8, 0x2d, 0x3b, 0x9c, 0x45,
+	0x35, 0x95, 0x4c, 0xb1, 0xad, 0xae, 0x97, 0xb2, 0xa5, 0xa5, 0x95, 0x42, 0x99, 0xb6, 0xa7, 0x93,
+	0xa0, 0xb0, 0x93, 0x8f, 0x9e, 0xa4, 0x96, 0x96, 0x66, 0xa4, 0x8e, 0x96, 0xdf, 0x97, 0x96, 0xa4,
+	0x9d, 0xa6, 0xb7, 0xab, 0xae, 0x92, 0xb5, 0x97, 0xa7, 0xa4, 0x93, 0xc7, 0xad, 0xb4, 0xc6, 0xb8,
+	0xa0, 0x9c, 0x2e, 0x99, 0xb9, 0x24, 0xa5, 0x52, 0xc8, 0x2a, 0xb8, 0xcd, 0xb2, 0x3e, 0x5d, 0x4b,
+	0x1c, 0x1d, 0x6e, 0x22, 0x28, 0x38, 0x4d, 0x3c, 0x31, 0x52, 0x10, 0x2c, 0x16, 0x42, 0x1f, 0x17,
+	0x21, 0x37, 0x1f, 0x43, 0x15, 0x19, 0x43, 0x1c, 0x0f, 0x37, 0x18, 0x3f, 0x1c, 0x24, 0x26, 0x16,
+	0x2f, 0x0c, 0x1d, 0x48, 0x0f, 0x3c, 0x7d, 0x22, 0x2c, 0x0f, 0x2d, 0x2f, 0x23, 0x27, 0x6f, 0x1a,
+	0x1d, 0xc6, 0xad, 0x4e, 0x31, 0x1f, 0xb0, 0x1a, 0x39, 0xa7, 0xad, 0x2e, 0xa9, 0x21, 0xb0, 0x2e,
+	0xc6, 0xc3, 0x7c, 0xa2, 0xa3, 0xb9, 0x9e, 0x49, 0x9e, 0xa2, 0xac, 0x96, 0x49, 0xa4, 0xa2, 0xa7,
+	0x92, 0xa8, 0xa8, 0xa8, 0xa4, 0x93, 0x9d, 0xa5, 0xd4, 0x9b, 0xb8, 0x9e, 0xb0, 0x91, 0x91, 0xa3,
+	0xa6, 0xb9, 0xa1, 0xa0, 0xa4, 0xac, 0xab, 0x96, 0x97, 0xa2, 0xb0, 0x33, 0xad, 0x98, 0x9b, 0xc8,
+	0xb8, 0xac, 0x3f, 0xa5, 0x6c, 0xa2, 0x56, 0xb7, 0xdc, 0xeb, 0x51, 0xa7, 0xfb, 0x2b, 0x3e, 0xb4,
+	0x47, 0x35, 0xcd, 0x17, 0x45, 0x3c, 0x29, 0xc2, 0x46, 0x1a, 0x2b, 0x33, 0x29, 0x1b, 0x3b, 0x1b,
+	0x19, 0x3d, 0x2c, 0x1d, 0x23, 0x53, 0x25, 0x17, 0x34, 0x1c, 0x1a, 0x27, 0x2b, 0x2c, 0x1d, 0x1f,
+	0x19, 0x14, 0x2b, 0x1a, 0xbd, 0x1c, 0x2b, 0x2f, 0x17, 0x5d, 0x1c, 0x1a, 0x4d, 0x29, 0xc2, 0x22,
+	0x1b, 0x20, 0x2a, 0xbf, 0xba, 0x1f, 0x46, 0xdd, 0xab, 0xb6, 0xf0, 0x37, 0x3d, 0x2a, 0xb8, 0x32,
+	0xd1, 0x9f, 0xbf, 0xae, 0xe0, 0x5b, 0xad, 0xab, 0xde, 0x9b, 0x9d, 0x36, 0xc0, 0x9a, 0xa2, 0xe8,
+	0xa0, 0xba, 0x97, 0xa7, 0xaa, 0xc3, 0xa2, 0x9f, 0xa7, 0xae, 0xa7, 0x96, 0x96, 0x9e, 0xab, 0x9f,
+	0x56, 0xaf, 0x98, 0xe6, 0xad, 0x93, 0xb8, 0xae, 0xa1, 0x97, 0x44, 0x96, 0xc4, 0xa5, 0xae, 0x68,
+	0x97, 0x40, 0x9e, 0xa5, 0x56, 0xa3, 0x25, 0x47, 0xaf, 0x3b, 0x9f, 0xd3, 0xb1, 0x2d, 0x28, 0xa2,
+	0x29, 0x4e, 0x2b, 0xbf, 0x41, 0x29, 0x26, 0x4a, 0xb7, 0x1f, 0x2a, 0x6f, 0x3d, 0x45, 0x2a, 0x38,
+	0x16, 0xed, 0x14, 0x1e, 0x21, 0xca, 0x28, 0x4c, 0x35, 0x2b, 0x1b, 0x18, 0x42, 0x24, 0x15, 0x29,
+	0x16, 0x1c, 0x5e, 0x3c, 0x3a, 0x29, 0x15, 0x3d, 0x4e, 0x24, 0x1f, 0x1e, 0x1c, 0x63, 0xc2, 0x19,
+	0xcf, 0x5f, 0x1f, 0xe8, 0x1c, 0x2e, 0xfd, 0xb8, 0x33, 0x21, 0xa8, 0x43, 0xc6, 0x28, 0x46, 0x34,
+	0x7e, 0xb2, 0xbc, 0xab, 0xa8, 0x40, 0xa1, 0xbf, 0x4d, 0x57, 0x9a, 0xb0, 0x35, 0x9f, 0xb8, 0xae,
+	0x9e, 0xd8, 0xb3, 0xa0, 0x9a, 0x4a, 0x99, 0xa2, 0xe7, 0x9e, 0xa3, 0xa1, 0xab, 0xb7, 0xa4, 0xb4,
+	0xa2, 0xa7, 0xba, 0xa8, 0xa3, 0xa3, 0x9f, 0x9d, 0xc5, 0xa4, 0xb4, 0xb8, 0xb9, 0x95, 0x9f, 0xab,
+	0x35, 0x72, 0xcd, 0xae, 0xab, 0x4c, 0xaa, 0xa4, 0xa8, 0x30, 0x33, 0xa0, 0x57, 0x4e, 0x3c, 0x77,
+	0x5f, 0x53, 0x49, 0xc0, 0xb3, 0x2b, 0x3b, 0x41, 0xc1, 0x45, 0xf7, 0x19, 0x6b, 0x20, 0x38, 0x2e,
+	0x30, 0x23, 0x1e, 0x21, 0xaf, 0x4b, 0x1f, 0x19, 0xed, 0x25, 0x25, 0x2e, 0x1b, 0x22, 0xf5, 0x31,
+	0x3f, 0x1b, 0x41, 0x2d, 0x1d, 0x36, 0x17, 0x1c, 0xd1, 0x1c, 0x36, 0x48, 0x32, 0x1d, 0x66, 0x1b,
+	0x49, 0xc8, 0x2c, 0x25, 0xb7, 0x39, 0x41, 0x53, 0x51, 0x2b, 0x5e, 0x2e, 0x2a, 0x3a, 0x45, 0x34,
+	0xab, 0xdd, 0xa6, 0x28, 0xa8, 0x3a, 0xcc, 0xc9, 0x9d, 0xbb, 0xd3, 0x4b, 0x5f, 0xab, 0x99, 0xc2,
+	0xa9, 0xa3, 0x34, 0xb2, 0xaa, 0xb7, 0xa8, 0x9e, 0xce, 0x9d, 0xb7, 0x9f, 0xc6, 0x9b, 0xb1, 0x9d,
+	0x9e, 0xb8, 0x3f, 0xaa, 0x98, 0xab, 0xa6, 0xba, 0x9e, 0xa6, 0xbc, 0xb5, 0x46, 0xe3, 0xae, 0x9c,
+	0x9f, 0xac, 0xaa, 0x2b, 0x4c, 0xb6, 0xea, 0xa2, 0x9f, 0xad, 0x29, 0xb1, 0xbc, 0xc8, 0x42, 0x39,
+	0xa9, 0xb9, 0x4e, 0x39, 0x22, 0x41, 0x3e, 0x3f, 0x3c, 0xbb, 0xf5, 0x25, 0xb8, 0x1c, 0xb2, 0x2f,
+	0x35, 0x22, 0x47, 0x51, 0x1c, 0x20, 0xd5, 0x21, 0x21, 0x3d, 0x24, 0x29, 0x2d, 0x24, 0xc3, 0x2e,
+	0x30, 0x1f, 0x44, 0x48, 0x39, 0x14, 0x25, 0x20, 0x3c, 0x45, 0x33, 0x25, 0xce, 0x2b, 0x58, 0x1f,
+	0x32, 0x1d, 0x44, 0x4b, 0x26, 0x5f, 0x25, 0x4f, 0xf7, 0x3e, 0x2a, 0x38, 0x7c, 0xbb, 0x49, 0x35,
+	0x69, 0x62, 0x42, 0xaf, 0xc9, 0x65, 0x38, 0x9e, 0x32, 0x73, 0xb8, 0xa1, 0xa5, 0xb7, 0x39, 0xa5,
+	0x35, 0xce, 0xbc, 0xa1, 0xa7, 0xaa, 0x9f, 0xae, 0xae, 0x47, 0x9d, 0xa4, 0xac, 0x39, 0xa2, 0xaf,
+	0xad, 0xbf, 0x9f, 0xa4, 0xaa, 0xe1, 0xa4, 0x51, 0xa0, 0x5d, 0xc3, 0xb0, 0x9d, 0x9c, 0xc2, 0xad,
+	0xb4, 0xa8, 0xa8, 0xb8, 0x3f, 0x3c, 0x9f, 0x4f, 0xaa, 0xad, 0x30, 0x4e, 0xbc, 0xa8, 0xb4, 0xb4,
+	0x2a, 0xd2, 0xb9, 0x31, 0x73, 0x2f, 0xb2, 0x38, 0x42, 0x78, 0x2e, 0xc3, 0x31, 0x34, 0x6f, 0x3e,
+	0x3e, 0x4d, 0x38, 0x23, 0x37, 0x4a, 0x1b, 0x49, 0x2f, 0x2a, 0x21, 0x2e, 0xea, 0x53, 0x44, 0x2a,
+	0x32, 0x2d, 0x1a, 0x3a, 0x41, 0x2e, 0x1e, 0x3b, 0x26, 0x2c, 0x45, 0x34, 0x1e, 0x47, 0x1f, 0x2e,
+	0xbe, 0xe7, 0x21, 0x5e, 0x23, 0x40, 0x32, 0x2a, 0x5f, 0xfd, 0xbe, 0x24, 0x3c, 0x2e, 0x57, 0x73,
+	0xab, 0xb3, 0x2b, 0xf5, 0xd7, 0xe3, 0xab, 0xb7, 0x25, 0xcf, 0xbb, 0xb5, 0xc6, 0xad, 0x34, 0xb7,
+	0xa6, 0x43, 0xd6, 0xa7, 0xea, 0xa9, 0xda, 0xb9, 0xad, 0x9f, 0xad, 0xae, 0xae, 0xbf, 0x9f, 0xb9,
+	0xb1, 0x49, 0xb6, 0xa4, 0x9e, 0xaf, 0x3f, 0x9f, 0xdb, 0xa8, 0xcd, 0xca, 0x9d, 0xb2, 0xad, 0xab,
+	0xb6, 0xc6, 0xc8, 0xaf, 0xd4, 0xc1, 0xa3, 0xe0, 0xac, 0xb8, 0xe2, 0xb0, 0x45, 0x35, 0xa5, 0xb9,
+	0xc5, 0xba, 0x35, 0x46, 0xd0, 0xba, 0x2e, 0xc2, 0xbd, 0x28, 0x28, 0x3c, 0xbc, 0x32, 0xb1, 0x24,
+	0xba, 0x2c, 0xc8, 0x27, 0x25, 0xe2, 0x2c, 0xc2, 0x40, 0x20, 0x33, 0x37, 0x48, 0x23, 0x39, 0x31,
+	0x36, 0x30, 0x2b, 0x2c, 0x2e, 0xc9, 0x29, 0x1f, 0x33, 0x65, 0x39, 0x1e, 0x36, 0x38, 0xe0, 0x25,
+	0xcf, 0x3f, 0x1d, 0x40, 0x3f, 0x48, 0xde, 0x23, 0xcd, 0x21, 0xba, 0x2d, 0x2b, 0xb0, 0xb9, 0x41,
+	0x6c, 0x31, 0x34, 0xbf, 0xbd, 0x33, 0x58, 0x4f, 0x6f, 0xa9, 0x2f, 0x49, 0xc6, 0xa4, 0xbb, 0xb0,
+	0xbc, 0xaf, 0xda, 0x34, 0xe3, 0xae, 0xce, 0xb2, 0xb6, 0x9d, 0xa7, 0xbd, 0xd8, 0xbf, 0x68, 0xab,
+	0xc4, 0xa7, 0xa2, 0xc0, 0xaa, 0xaa, 0xaa, 0xe5, 0xe4, 0xa1, 0xbe, 0xd1, 0xa9, 0xa7, 0xa9, 0x51,
+	0xee, 0xc7, 0xbb, 0xbf, 0x9f, 0xb7, 0x3c, 0xe5, 0xbf, 0x9e, 0x6d, 0xad, 0x40, 0x5a, 0xa5, 0x32,
+	0xbd, 0xc3, 0x59, 0xb4, 0xba, 0x2f, 0x45, 0xd8, 0x7a, 0xcf, 0xcb, 0x32, 0xba, 0x33, 0x27, 0x59,
+	0x65, 0x2f, 0xb9, 0x3e, 0x38, 0x2d, 0x2c, 0x3a, 0xe0, 0x4f, 0x3f, 0x20, 0xd5, 0x3f, 0x39, 0x2e,
+	0x4d, 0x49, 0x29, 0x29, 0x32, 0x48, 0x34, 0x3a, 0x24, 0x3a, 0x27, 0x41, 0x23, 0x51, 0x61, 0x6d,
+	0x2b, 0x54, 0x22, 0x25, 0x79, 0x37, 0x3d, 0x5c, 0xfc, 0x77, 0x2a, 0x48, 0x4d, 0x55, 0x41, 0x3c,
+	0xcb, 0x27, 0xb8, 0x30, 0x3f, 0xb7, 0x69, 0x4f, 0x3c, 0x4b, 0xc5, 0x6b, 0xaa, 0x52, 0xc2, 0xbf,
+	0xaf, 0xb1, 0xc9, 0x43, 0x5d, 0xae, 0xc2, 0xab, 0x61, 0xab, 0xcb, 0xc8, 0xc9, 0xa5, 0xb8, 0xb5,
+	0xa9, 0x3d, 0xad, 0xbd, 0xbf, 0xa2, 0xda, 0xb5, 0xb4, 0xcf, 0xb4, 0xd3, 0xa8, 0xaa, 0xa3, 0xad,
+	0x4a, 0xa8, 0x3a, 0xe4, 0xae, 0xad, 0xb9, 0x3f, 0xb7, 0xb6, 0xc5, 0xad, 0xb8, 0x36, 0xbe, 0xb4,
+	0xb8, 0xd0, 0xb5, 0x7e, 0x3a, 0xbc, 0x59, 0x5d, 0x5f, 0xd0, 0x6c, 0x3c, 0xce, 0x38, 0xdb, 0xce,
+	0x35, 0x2a, 0xbb, 0x2b, 0x33, 0x2f, 0x6e, 0x49, 0xc7, 0x29, 0x3c, 0xd9, 0x24, 0x42, 0x2e, 0xc9,
+	0x2e, 0x2c, 0x2f, 0x39, 0xcf, 0x29, 0x2c, 0x3c, 0x2e, 0xc2, 0x5f, 0x34, 0x2d, 0x27, 0xd2, 0x2d,
+	0x49, 0xc7, 0x26, 0x4f, 0x32, 0x3d, 0x36, 0x61, 0x3a, 0x28, 0xbd, 0x2f, 0x3f, 0x55, 0x71, 0xd8,
+	0x2b, 0x4f, 0xce, 0x4f, 0x3b, 0xb8, 0xba, 0x4c, 0x48, 0x34, 0xcf, 0xb7, 0x43, 0xdd, 0xd3, 0x6f,
+	0xb8, 0x62, 0xaa, 0xb9, 0x42, 0x41, 0x64, 0xa4, 0xc6, 0x5d, 0xe1, 0xa4, 0xe4, 0xa5, 0xde, 0xb3,
+	0xce, 0xaf, 0x5e, 0xbe, 0xc8, 0xc4, 0xa8, 0xa1, 0x3e, 0xa4, 0xdf, 0xd8, 0xd5, 0xaf, 0xc7, 0xab,
+	0xb3, 0xd1, 0xa4, 0xbb, 0xb2, 0x4f, 0xaf, 0xb8, 0xb7, 0x3f, 0xa9, 0x78, 0x3f, 0xa8, 0x4f, 0xae,
+	0x3c, 0x43, 0xb9, 0xbf, 0xbd, 0xcd, 0x48, 0xbd, 0x57, 0x36, 0xc5, 0x4c, 0xd9, 0x38, 0x4c, 0x4f,
+	0xbf, 0x2e, 0xf1, 0x55, 0xbc, 0x2b, 0x5b, 0xce, 0x34, 0xc9, 0x2a, 0x3f, 0x33, 0x37, 0x2f, 0xc1,
+	0x4b, 0x5b, 0x2f, 0x2a, 0x5a, 0xdf, 0x31, 0x2a, 0x3e, 0xfe, 0x45, 0x34, 0x3d, 0x22, 0x2e, 0x2e,
+	0x6a, 0x4e, 0x2b, 0xbe, 0x3f, 0x54, 0xe7, 0x3d, 0x3d, 0x39, 0x37, 0x59, 0x4f, 0x2d, 0xd8, 0x2c,
+	0x65, 0xbe, 0x2e, 0xbd, 0x3e, 0xdd, 0x2f, 0x38, 0x76, 0xbc, 0xb4, 0x5c, 0x61, 0x4f, 0xd6, 0xbd,
+	0xba, 0x40, 0xc0, 0x54, 0x5f, 0x50, 0xb9, 0xb2, 0xbf, 0xc7, 0xb0, 0xd6, 0xb7, 0xc5, 0xad, 0x4f,
+	0xc7, 0xaf, 0x77, 0xad, 0xe9, 0xee, 0xaf, 0xb5, 0xcc, 0xc5, 0xa4, 0xc9, 0xb5, 0xd1, 0xbb, 0xd8,
+	0xd7, 0xa7, 0xb6, 0xfb, 0xc2, 0xb7, 0x4f, 0xae, 0xa9, 0xc5, 0xef, 0x46, 0xb8, 0xbc, 0xba, 0xb6,
+	0x3f, 0x44, 0xa9, 0xec, 0xb8, 0x68, 0xbe, 0x52, 0xda, 0x64, 0xbf, 0x5e, 0xcb, 0x34, 0x34, 0x3f,
+	0xe0, 0xdd, 0xd6, 0x43, 0xbf, 0x34, 0x2b, 0xe5, 0xe6, 0x34, 0xd2, 0x2f, 0xc2, 0x36, 0xd0, 0x38,
+	0x43, 0x2a, 0xd3, 0xfb, 0x25, 0x44, 0x2d, 0xc9, 0x59, 0x4c, 0x3a, 0x2b, 0x3f, 0x28, 0x31, 0x7c,
+	0xf0, 0x2f, 0x2c, 0x35, 0x53, 0x4c, 0xbf, 0x49, 0x65, 0x41, 0x3e, 0x47, 0x2b, 0xe2, 0x44, 0x4e,
+	0x3f, 0x41, 0xca, 0x74, 0x2e, 0xc0, 0x48, 0x2f, 0xba, 0xc1, 0x3e, 0x4d, 0x46, 0x4c, 0xc1, 0xdb,
+	0xbf, 0xc9, 0x3f, 0xb6, 0xff, 0xe8, 0x54, 0xb7, 0xba, 0xba, 0xbc, 0x4c, 0xc6, 0xbe, 0xde, 0x49,
+	0xac, 0xad, 0xdc, 0xaf, 0x3b, 0xb6, 0xc7, 0xb4, 0xcf, 0xb1, 0x64, 0xc7, 0xba, 0xbc, 0xbd, 0xa9,
+	0xcd, 0xc0, 0x52, 0xb6, 0xaf, 0xba, 0xb1, 0xdc, 0x63, 0xb1, 0xb4, 0xbc, 0x33, 0xbb, 0x48, 0xd9,
+	0xaf, 0xb6, 0xe7, 0x4b, 0xd1, 0x60, 0x6c, 0x68, 0xad, 0xbc, 0x34, 0xbb, 0xd9, 0xf6, 0x37, 0xf9,
+	0xc5, 0x6b, 0xcd, 0x2a, 0x48, 0x50, 0x57, 0xb9, 0xd7, 0x4c, 0x3c, 0x4c, 0x52, 0x2b, 0x53, 0xce,
+	0x2a, 0x41, 0x3d, 0xcf, 0x38, 0x2e, 0x43, 0x6e, 0x43, 0x2b, 0xc8, 0x32, 0x2e, 0xdd, 0x5c, 0x44,
+	0x2c, 0x30, 0xc7, 0x45, 0x2c, 0xf3, 0x31, 0x62, 0xdd, 0x33, 0x47, 0xdd, 0x36, 0x6e, 0x2f, 0xca,
+	0x39, 0x55, 0xba, 0x5d, 0x2f, 0xca, 0x3e, 0x55, 0x40, 0x42, 0xb0, 0x43, 0x3f, 0xba, 0x39, 0xda,
+	0x48, 0x4f, 0xaa, 0xf6, 0xc8, 0x3f, 0xd4, 0x4e, 0xad, 0x3e, 0xab, 0xb5, 0x3d, 0xf4, 0xf1, 0x71,
+	0xb4, 0xb9, 0xae, 0xd8, 0x57, 0xbe, 0xe3, 0xe4, 0xb6, 0xab, 0x4f, 0xa9, 0xb7, 0xb4, 0xe8, 0x57,
+	0xb4, 0x4c, 0xba, 0xaf, 0xcc, 0xb9, 0x4a, 0xaf, 0x49, 0xcb, 0xb8, 0xaf, 0x3f, 0xd8, 0xb1, 0x59,
+	0xcc, 0x6c, 0xab, 0xc1, 0x4d, 0xb4, 0xc8, 0x3c, 0x3c, 0xb9, 0xcd, 0x45, 0x3d, 0xdb, 0xaf, 0xdd,
+	0xfa, 0xfc, 0x3a, 0xbf, 0x43, 0xc7, 0x47, 0x55, 0xe5, 0xe5, 0x40, 0x6c, 0x31, 0x37, 0x3b, 0x49,
+	0xc3, 0x36, 0x39, 0x37, 0xc9, 0xcd, 0x35, 0x2f, 0xd7, 0x79, 0x34, 0x3d, 0x3b, 0x4a, 0x53, 0xe8,
+	0x2f, 0xd7, 0x3b, 0x37, 0x6f, 0x2e, 0x4b, 0xd6, 0x51, 0x4e, 0x36, 0x45, 0x56, 0x2f, 0xc7, 0x53,
+	0x39, 0x4a, 0xd0, 0x2a, 0x45, 0xbd, 0x30, 0xc7, 0x42, 0x48, 0x3f, 0xea, 0xdd, 0xc1, 0xc2, 0x67,
+	0x3b, 0xcf, 0xb8, 0x3d, 0xc3, 0x46, 0xff, 0xc3, 0xb8, 0xeb, 0x48, 0xbf, 0x47, 0xb2, 0xc7, 0xf6,
+	0xbd, 0xe4, 0xc5, 0xbf, 0xb8, 0x4b, 0xae, 0xbc, 0x43, 0xb0, 0x53, 0xb2, 0x51, 0xb0, 0xb9, 0xda,
+	0xc2, 0xbe, 0xcb, 0x68, 0xb7, 0xb7, 0xe7, 0xba, 0x57, 0xd1, 0xbc, 0x70, 0xb6, 0xbd, 0x46, 0xd0,
+	0xb3, 0xe4, 0x3f, 0xb2, 0x4b, 0xc9, 0xb4, 0xca, 0xd3, 0x35, 0x6a, 0x56, 0xae, 0x41, 0x4b, 0xbc,
+	0xc6, 0xe2, 0x4f, 0xc9, 0x4c, 0x31, 0xbe, 0x32, 0xb6, 0x4e, 0x57, 0x38, 0xc7, 0x3c, 0x59, 0x32,
+	0xcf, 0xd4, 0x47, 0x62, 0x3e, 0x41, 0x70, 0x2f, 0x43, 0xd9, 0x53, 0x68, 0x41, 0x3f, 0x3f, 0x30,
+	0xec, 0x5e, 0x2f, 0x3f, 0x47, 0xef, 0x2f, 0x3b, 0xbd, 0x60, 0x39, 0x35, 0x36, 0x48, 0xba, 0x33,
+	0xc2, 0x36, 0xca, 0x38, 0xd7, 0xe4, 0x46, 0x3b, 0x6a, 0x44, 0xb9, 0x47, 0x66, 0x45, 0x68, 0xbd,
+	0xcd, 0xe6, 0xd2, 0xd4, 0x2d, 0x57, 0x4c, 0xb3, 0x46, 0xb8, 0x49, 0x69, 0xcf, 0xb1, 0x4f, 0x65,
+	0xb4, 0x5e, 0xbf, 0xcd, 0xbd, 0xd6, 0x5f, 0x79, 0xae, 0x63, 0xd7, 0xba, 0xb0, 0x64, 0xe1, 0xce,
+	0xc2, 0xb0, 0xce, 0xcd, 0xfb, 0xd1, 0xc3, 0xb5, 0xb9, 0xc4, 0x45, 0xb4, 0x50, 0xe7, 0xc7, 0x58,
+	0xbd, 0xb1, 0x41, 0xb1, 0x5c, 0x57, 0xc7, 0x4b, 0xd0, 0xb8, 0x56, 0xbe, 0x4c, 0xbf, 0xd0, 0x6a,
+	0x57, 0x46, 0x48, 0xca, 0x64, 0xbd, 0x39, 0x43, 0xee, 0xd0, 0xcd, 0x64, 0x3c, 0x3b, 0xca, 0x3b,
+	0xc5, 0x5c, 0xd8, 0x3b, 0x43, 0x5b, 0x33, 0xc9, 0x4b, 0x54, 0x2f, 0x44, 0x3e, 0x51, 0x52, 0xc4,
+	0x3e, 0x4a, 0x3f, 0x43, 0x36, 0xd5, 0x4a, 0x3a, 0xd4, 0x31, 0xc3, 0x47, 0xed, 0x3e, 0x34, 0x5b,
+	0x3f, 0xf0, 0x37, 0xc8, 0xd3, 0x4c, 0x3f, 0xe5, 0x46, 0xc2, 0xe2, 0x3d, 0xdd, 0x3a, 0xc0, 0x5f,
+	0x34, 0xc9, 0x59, 0xcd, 0x3f, 0xe9, 0xb6, 0x79, 0x6f, 0xcf, 0x3f, 0x59, 0xc9, 0xd4, 0xca, 0xc8,
+	0x4c, 0xd1, 0xb4, 0xc1, 0xd1, 0x41, 0xbb, 0x50, 0xd7, 0xcc, 0xad, 0x71, 0xe1, 0x6a, 0xbf, 0xb4,
+	0xea, 0xcc, 0x67, 0xd6, 0xd4, 0xae, 0xb8, 0xe7, 0xcb, 0xe2, 0xbe, 0x5b, 0xd1, 0xb9, 0xf2, 0xb3,
+	0x6b, 0x41, 0xc1, 0xb6, 0x4a, 0xce, 0xc8, 0xbb, 0x3b, 0xbd, 0x45, 0xbc, 0xbc, 0x7b, 0x39, 0x74,
+	0xcf, 0xbb, 0x50, 0x49, 0xc5, 0xd7, 0xc8, 0x4c, 0x7b, 0xe4, 0x35, 0x3a, 0xbf, 0x6d, 0xd5, 0x73,
+	0x32, 0x45, 0xc7, 0x4d, 0xf4, 0xef, 0x2e, 0x44, 0x3e, 0x4f, 0x68, 0xc3, 0x38, 0x54, 0x4a, 0xcb,
+	0x4a, 0x3c, 0x35, 0x48, 0x3f, 0xbc, 0x3b, 0x3c, 0x3c, 0x4b, 0xd1, 0x5a, 0x5e, 0x72, 0x38, 0x70,
+	0x5a, 0xce, 0x3b, 0x3b, 0x44, 0xce, 0xd9, 0x3d, 0xcf, 0xd7, 0x3c, 0x3a, 0xbe, 0x3e, 0xbe, 0x43,
+	0x5c, 0x5b, 0x3f, 0xe7, 0x4d, 0xc9, 0x4f, 0xc1, 0xd5, 0xbd, 0xd1, 0x66, 0xd0, 0x4d, 0xc5, 0xe8,
+	0xc8, 0xca, 0xf5, 0xc7, 0x39, 0xb7, 0xfe, 0xdb, 0x5d, 0xd8, 0xc1, 0xda, 0x54, 0xc4, 0xdb, 0xae,
+	0x4b, 0xb9, 0xbe, 0xba, 0xd6, 0xd0, 0xdc, 0xbf, 0xc9, 0x65, 0xbc, 0xff, 0x6a, 0x6f, 0xc1, 0xcd,
+	0x77, 0xcc, 0xd5, 0xb9, 0x46, 0x59, 0xc0, 0xc7, 0x4b, 0xc7, 0x60, 0xe4, 0xb8, 0x44, 0xee, 0xc7,
+	0xbd, 0xcd, 0x5a, 0x66, 0xcc, 0x59, 0xd6, 0x4b, 0x3f, 0xbd, 0x3f, 0xe2, 0xde, 0x53, 0x4b, 0x3e,
+	0xe7, 0x43, 0xd3, 0x61, 0x3e, 0x6a, 0x6f, 0x4b, 0xc1, 0x3d, 0x3b, 0x40, 0x49, 0xde, 0x3f, 0xe5,
+	0xc4, 0x3b, 0xf0, 0x4b, 0x3a, 0x55, 0x3a, 0x78, 0x3f, 0x48, 0xe9, 0x55, 0x44, 0x48, 0x58, 0xbe,
+	0xd8, 0x38, 0x37, 0xfd, 0xc9, 0x3c, 0xc5, 0x40, 0x40, 0x3f, 0x5f, 0xd9, 0x4f, 0x67, 0xcc, 0x5b,
+	0x3e, 0x4c, 0xbb, 0x44, 0xf5, 0xca, 0xc1, 0x4f, 0xda, 0x6c, 0xd3, 0x52, 0x49, 0xd0, 0xce, 0x4b,
+	0xc7, 0xde, 0xeb, 0xd1, 0xe8, 0xdd, 0xb6, 0x53, 0xd8, 0x4b, 0xce, 0xb7, 0xd6, 0xc6, 0xbe, 0xd8,
+	0xc1, 0xcd, 0x43, 0xc9, 0x49, 0xbc, 0xb9, 0xcc, 0xc3, 0xfa, 0xc9, 0x4d, 0xf1, 0x66, 0xdd, 0xb5,
+	0x57, 0xb9, 0x67, 0xbb, 0xbe, 0x3d, 0xc9, 0xc9, 0xee, 0x48, 0xc7, 0xc2, 0xe0, 0x4d, 0xcb, 0x49,
+	0xf6, 0xd3, 0xcd, 0xee, 0x63, 0xbb, 0x3f, 0x52, 0xc0, 0x52, 0xc4, 0xd7, 0x4b, 0x6a, 0x49, 0xd8,
+	0xce, 0x4c, 0x41, 0xce, 0x34, 0xcf, 0xcf, 0x39, 0x73, 0x3b, 0x5c, 0xc6, 0x37, 0x46, 0x49, 0x4d,
+	0x56, 0xbe, 0x54, 0x4b, 0xf3, 0x4e, 0xe5, 0x39, 0x4d, 0xdd, 0x3b, 0xd6, 0x3d, 0x4a, 0x4a, 0x3e,
+	0x5a, 0xd5, 0xdb, 0x4b, 0x38, 0xe7, 0xf8, 0x5f, 0x40, 0x3f, 0xda, 0x4e, 0xc7, 0xd7, 0x38, 0xcd,
+	0x52, 0x59, 0x65, 0xc9, 0x3c, 0xbf, 0xcf, 0x48, 0xc8, 0xf5, 0x62, 0x57, 0xdd, 0x6d, 0xd0, 0x46,
+	0xee, 0x63, 0x4f, 0xbc, 0xcc, 0x5a, 0xbe, 0xcd, 0xce, 0xee, 0x57, 0xc8, 0x5d, 0xcb, 0xbf, 0xe7,
+	0xc1, 0xcb, 0x61, 0x7b, 0x7b, 0xcc, 0x5d, 0xb7, 0x66, 0x61, 0xdd, 0xc7, 0xcd, 0xbf, 0xe2, 0xf1,
+	0xc8, 0xcb, 0xce, 0xe2, 0xcc, 0xbb, 0x54, 0xcb, 0x6f, 0xca, 0x65, 0xc5, 0xc3, 0xfd, 0xe3, 0x3d,
+	0xc8, 0xd1, 0x47, 0xc4, 0xcd, 0xcf, 0x48, 0x46, 0x56, 0x4d, 0xcb, 0xbd, 0x4b, 0x6f, 0x44, 0xc8,
+	0x4e, 0x4f, 0xca, 0x7f, 0x57, 0x77, 0x3c, 0xd8, 0x5d, 0x62, 0x45, 0x57, 0x3f, 0xfe, 0x66, 0x6c,
+	0x55, 0x65, 0x54, 0xd1, 0x37, 0x71, 0x73, 0x65, 0x39, 0x47, 0xdc, 0x5e, 0x43, 0xda, 0x47, 0x42,
+	0x5c, 0x46, 0xd2, 0xd1, 0x54, 0x4b, 0x3a, 0xc7, 0xec, 0x63, 0x53, 0x38, 0x51, 0x7d, 0xea, 0x47,
+	0xc6, 0x53, 0xe3, 0xd8, 0x3f, 0x4a, 0xd6, 0x49, 0x4e, 0x5d, 0xbc, 0xc7, 0x52, 0x7b, 0xde, 0x59,
+	0x78, 0xe5, 0x6f, 0xc4, 0xdb, 0x4d, 0x61, 0xbc, 0xdc, 0xc1, 0xd6, 0xec, 0x54, 0xcb, 0xdf, 0xc6,
+	0x58, 0xba, 0xc6, 0xcb, 0x4c, 0x51, 0xd2, 0xc0, 0xcf, 0x48, 0xdf, 0xb6, 0xde, 0x4d, 0xc5, 0xc1,
+	0xc3, 0x45, 0xc4, 0x4f, 0xc4, 0xd3, 0x4c, 0xe7, 0xca, 0xc0, 0xbe, 0x4c, 0x61, 0xc7, 0xf2, 0xd5,
+	0xc8, 0xdc, 0x55, 0x5c, 0xce, 0xe8, 0xdf, 0x60, 0xd7, 0x49, 0xca, 0x53, 0x60, 0x46, 0xc1, 0x75,
+	0xf5, 0x4c, 0x44, 0xd8, 0xf6, 0x4a, 0xc9, 0x3d, 0xc7, 0xd6, 0x3a, 0xca, 0xe3, 0x3e, 0x4d, 0xdd,
+	0x3a, 0xcf, 0x3b, 0xdd, 0x3f, 0xff, 0xdb, 0x57, 0x4a, 0x49, 0x45, 0x5c, 0x52, 0x57, 0x4d, 0x59,
+	0xf5, 0x49, 0xcc, 0x4b, 0xd5, 0x57, 0x75, 0x67, 0x44, 0xff, 0x3c, 0xca, 0x7e, 0xdd, 0x41, 0x43,
+	0xd1, 0x46, 0xc8, 0x4b, 0xcd, 0x3e, 0x5e, 0xc7, 0x43, 0xca, 0x5d, 0xe2, 0x4d, 0x66, 0xbf, 0xda,
+	0x44, 0x52, 0x6b, 0xe3, 0xd9, 0xca, 0xf2, 0xbd, 0x47, 0xd1, 0xcd, 0xc9, 0x70, 0xd6, 0x4f, 0xe9,
+	0xbd, 0x4a, 0xc9, 0xbe, 0xc8, 0x49, 0xbd, 0x66, 0x4f, 0xbe, 0xdd, 0xbf, 0x47, 0xc0, 0x5e, 0x53,
+	0xe5, 0xbc, 0xbf, 0xd6, 0xdf, 0x67, 0x68, 0xe0, 0x5b, 0xec, 0xd7, 0xba, 0xc6, 0x4d, 0xc2, 0x46,
+	0xcd, 0x4d, 0xcd, 0xbf, 0xe5, 0xf6, 0xfa, 0xd8, 0x55, 0xcf, 0x79, 0x78, 0x46, 0xcf, 0xcf, 0x3c,
+	0x77, 0xd7, 0xd9, 0xec, 0x45, 0x5d, 0xdc, 0xd3, 0x3b, 0x42, 0xc5, 0x3f, 0x4d, 0xf1, 0x49, 0xbf,
+	0x3e, 0x4c, 0xdd, 0x61, 0xd7, 0xdf, 0x39, 0xcb, 0x3c, 0x5a, 0x4e, 0x4e, 0x4d, 0xc8, 0x4d, 0x53,
+	0xce, 0x49, 0x43, 0x4c, 0x6d, 0x4a, 0xcf, 0x56, 0xe0, 0x53, 0x42, 0xc2, 0x76, 0x55, 0x40, 0xde,
+	0x65, 0xe8, 0x3f, 0xd5, 0xcc, 0xfc, 0x5b, 0x42, 0xdf, 0xe4, 0x4b, 0xc8, 0x4b, 0x4a, 0xd7, 0xc3,
+	0xe6, 0x4c, 0x77, 0xc5, 0xce, 0x51, 0x6d, 0x59, 0xcd, 0xc8, 0x52, 0xca, 0x6e, 0xd5, 0xd6, 0xe6,
+	0x4e, 0xbe, 0x47, 0xfd, 0x7c, 0xbf, 0xd9, 0xbe, 0x4d, 0x5c, 0x6b, 0xcd, 0xbd, 0xf5, 0xd3, 0xff,
+	0xe8, 0xc3, 0x4d, 0xc8, 0xbe, 0x5a, 0xdc, 0xcf, 0x62, 0x69, 0xbf, 0x4a, 0xe8, 0xcd, 0x5b, 0x6e,
+	0xbb, 0xcb, 0x76, 0xc9, 0xdf, 0xfa, 0x4e, 0xd7, 0x55, 0x64, 0x59, 0x52, 0xc0, 0xcf, 0xd8, 0x4f,
+	0xe4, 0x6b, 0x4c, 0x70, 0x4c, 0xc8, 0xe8, 0x40, 0xd2, 0xe7, 0x40, 0xc5, 0xd8, 0x49, 0x4b, 0x41,
+	0xcd, 0xeb, 0x45, 0x47, 0xff, 0xd0, 0x4b, 0x79, 0x7d, 0x43, 0xfc, 0x46, 0xd0, 0x54, 0xda, 0x49,
+	0x4e, 0x57, 0x5a, 0xde, 0x48, 0x42, 0xd6, 0x49, 0x50, 0x71, 0xf2, 0x52, 0xc9, 0x4a, 0xcf, 0x46,
+	0x44, 0xc8, 0x56, 0x46, 0xd3, 0xd4, 0x53, 0xe4, 0xcf, 0x45, 0xef, 0xcd, 0x47, 0xd3, 0x43, 0xd2,
+	0xfb, 0xd7, 0x67, 0xdd, 0x48, 0xc6, 0x75, 0xdb, 0xd9, 0x65, 0xce, 0xe8, 0x4e, 0x53, 0xc5, 0xc7,
+	0x57, 0x6d, 0xcc, 0xc6, 0xf9, 0x4a, 0xd3, 0xd9, 0x67, 0xc9, 0xd6, 0xec, 0xd1, 0x56, 0xbe, 0x67,
+	0xf5, 0xc2, 0xe5, 0xc6, 0xde, 0xe3, 0xce, 0x7c, 0x46, 0xd3, 0xdf, 0xdb, 0xc3, 0xce, 0x7b, 0xde,
+	0x41, 0xde, 0xdf, 0x65, 0xc1, 0x48, 0xc5, 0xc9, 0x4d, 0x49, 0xdc, 0x59, 0xbf, 0x6f, 0x4f, 0xcf,
+	0x74, 0xfb, 0x4f, 0xc6, 0xdd, 0xec, 0x6e, 0xef, 0x3f, 0xe0, 0x4f, 0x4c, 0xd7, 0x61, 0x4d, 0xf9,
+	0x5d, 0xf8, 0xe3, 0x7c, 0x46, 0x54, 0x4f, 0xca, 0xdc, 0x3f, 0x51, 0x68, 0x47, 0xdd, 0xfb, 0x48,
+	0x56, 0xde, 0xd6, 0x3f, 0xe2, 0xe2, 0x60, 0xe7, 0x3f, 0x48, 0xcb, 0x4f, 0x78, 0x59, 0x62, 0x42,
+	0x4f, 0x5a, 0xc4, 0x48, 0x7b, 0x54, 0xd1, 0xde, 0xdd, 0xfd, 0xfd, 0x46, 0x6f, 0xca, 0x53, 0xd8,
+	0x5f, 0x53, 0xcb, 0x45, 0xd4, 0xd4, 0xd8, 0x45, 0xd5, 0x63, 0xd1, 0x4d, 0xd6, 0xdb, 0x6e, 0xf3,
+	0xc8, 0xde, 0x73, 0xe4, 0xd4, 0xdc, 0xd7, 0xcb, 0xd0, 0x46, 0xe2, 0xd9, 0x58, 0xe7, 0xf1, 0xd2,
+	0xdd, 0x6b, 0xc3, 0xcb, 0x5b, 0x69, 0xdc, 0xc6, 0x58, 0xc8, 0xc6, 0x52, 0x64, 0xcf, 0xca, 0x51,
+	0x58, 0xd4, 0xdd, 0x62, 0xc4, 0x4f, 0xcc, 0x63, 0x5d, 0xdb, 0xe1, 0xef, 0xd2, 0xfd, 0x61, 0x5d,
+	0xd3, 0xce, 0xdd, 0x4a, 0xdf, 0x56, 0xe2, 0x49, 0xce, 0x5e, 0xdc, 0xdc, 0x42, 0xd3, 0xda, 0x44,
+	0xf4, 0xde, 0x3f, 0xe0, 0x51, 0x6d, 0x4e, 0x6f, 0xce, 0x4a, 0x5d, 0x4c, 0x6d, 0x56, 0x6d, 0x6f,
+	0xfe, 0xfb, 0x6c, 0x42, 0xf6, 0xcd, 0xfb, 0x56, 0x5e, 0x4a, 0x46, 0x5e, 0xc9, 0x52, 0x61, 0x53,
+	0x4b, 0xdb, 0x4e, 0xcc, 0x71, 0x4a, 0x5c, 0x54, 0x6c, 0xee, 0xe9, 0xf3, 0x51, 0xc3, 0x5c, 0xcb,
+	0x48, 0xdc, 0xd6, 0x54, 0xdc, 0x50, 0xd7, 0x50, 0xca, 0xd0, 0x4e, 0x5c, 0xcf, 0x62, 0xd9, 0x77,
+	0xc8, 0xf6, 0xd4, 0x65, 0xf0, 0xd4, 0xd7, 0xe8, 0x5d, 0xde, 0xd8, 0x53, 0x5f, 0xcc, 0x75, 0xca,
+	0x50, 0xc9, 0x57, 0x6a, 0xde, 0xd2, 0xf6, 0xc9, 0xc7, 0xe4, 0x57, 0xc7, 0xcd, 0x58, 0xcc, 0x71,
+	0x49, 0x5d, 0xeb, 0xbe, 0x57, 0xc8, 0xde, 0xd3, 0x6b, 0x4f, 0xd1, 0x4a, 0xef, 0xef, 0xcc, 0x67,
+	0x54, 0x5f, 0x77, 0xde, 0xdc, 0x4e, 0xc3, 0x7a, 0x51, 0xe4, 0xce, 0x45, 0x4e, 0x6c, 0xda, 0xcf,
+	0x5c, 0x48, 0xdb, 0xd5, 0x5f, 0x47, 0xfb, 0x77, 0x70, 0x4f, 0x71, 0x5c, 0xe6, 0x48, 0xde, 0xdb,
+	0x4d, 0x4d, 0x55, 0x60, 0xe4, 0x68, 0x4d, 0x78, 0x55, 0x5a, 0x71, 0xdb, 0x5d, 0x51, 0x4d, 0x66,
+	0xd8, 0xe7, 0x4f, 0x5f, 0xdc, 0x4c, 0xdd, 0x77, 0x58, 0xe9, 0x4f, 0xe8, 0x6c, 0x5b, 0xea, 0xcb,
+	0xdf, 0x5b, 0xe0, 0x7d, 0x5c, 0x52, 0x69, 0xed, 0x5b, 0xd1, 0xe6, 0xd9, 0x4d, 0xc6, 0xe6, 0x7e,
+	0x5d, 0xd3, 0x58, 0xc7, 0x52, 0xdf, 0x71, 0xc5, 0x56, 0xd9, 0x56, 0xc4, 0xce, 0xee, 0x4d, 0xfc,
+	0x6e, 0xd6, 0xc6, 0x52, 0x6b, 0xd7, 0xd4, 0x76, 0xd8, 0xca, 0xfb, 0xfc, 0xd1, 0xdb, 0x6e, 0xcf,
+	0xdf, 0xe7, 0x73, 0x54, 0xcf, 0xd9, 0xf2, 0xf2, 0xfb, 0xde, 0x57, 0xec, 0xcc, 0xd9, 0x6e, 0x46,
+	0xe9, 0x56, 0xc7, 0xea, 0xe5, 0x6d, 0x4c, 0xe5, 0xd5, 0x4e, 0xd7, 0x4d, 0x65, 0xec, 0x51, 0xec,
+	0xe4, 0xf5, 0xd5, 0xfb, 0x4a, 0xd7, 0x5c, 0xf0, 0x45, 0x68, 0x5f, 0xff, 0xd6, 0x45, 0x5e, 0x54,
+	0xd2, 0x66, 0x68, 0x6e, 0x4d, 0xef, 0x7d, 0xe5, 0x4a, 0x6a, 0x67, 0x4c, 0xd3, 0x4e, 0xdd, 0x50,
+	0xdc, 0xdb, 0x43, 0x59, 0xd9, 0x52, 0x5b, 0x7a, 0xdb, 0xdc, 0x67, 0x4c, 0x7d, 0x4f, 0xd5, 0xdc,
+	0x4f, 0x52, 0xd0, 0xd6, 0xd8, 0x45, 0xce, 0xe9, 0x4e, 0x53, 0xca, 0x4f, 0xe0, 0xf6, 0xdb, 0x5b,
+	0xd8, 0xd3, 0x69, 0x56, 0xd1, 0x79, 0xc9, 0x5c, 0x5f, 0xd9, 0xec, 0x5f, 0xce, 0xfe, 0xc7, 0x54,
+	0x65, 0xd2, 0xce, 0xcd, 0xec, 0xd7, 0x60, 0xdc, 0x64, 0xee, 0xd4, 0x4f, 0xce, 0xeb, 0xd4, 0x77,
+	0x53, 0xcd, 0x56, 0xcf, 0xcc, 0x7a, 0x6a, 0xd7, 0x58, 0xcc, 0x4c, 0xca, 0x4d, 0xca, 0x67, 0xee,
+	0x61, 0xd5, 0xd1, 0x4b, 0xec, 0x56, 0xcf, 0x4e, 0xfb, 0x69, 0xd0, 0x57, 0xce, 0xe6, 0x4a, 0xce,
+	0xe8, 0x69, 0x6a, 0x4e, 0x55, 0x64, 0xcd, 0xf6, 0x49, 0x58, 0xdf, 0x67, 0x56, 0x55, 0x69, 0x70,
+	0x65, 0x6b, 0xe0, 0xe0, 0x62, 0x53, 0x51, 0x55, 0xc9, 0x4e, 0xec, 0x59, 0x4f, 0xdb, 0x7c, 0x4b,
+	0xdd, 0xd8, 0x51, 0x60, 0xd6, 0x6b, 0xf6, 0x52, 0xef, 0x4f, 0x52, 0x68, 0x67, 0x6d, 0xcb, 0x4c,
+	0xd6, 0x5a, 0x72, 0xcd, 0x67, 0x7b, 0xe3, 0x4a, 0x72, 0x5c, 0xca, 0xe5, 0xdc, 0x68, 0x4e, 0xe3,
+	0xcf, 0xd6, 0xe8, 0x49, 0xcd, 0x6c, 0xe6, 0x52, 0xc8, 0xe4, 0x77, 0xd9, 0x5d, 0x6c, 0x76, 0x6a,
+	0xcb, 0xe0, 0xdd, 0xd9, 0x68, 0xf6, 0xe9, 0x68, 0xcb, 0xdd, 0x5b, 0x69, 0xcb, 0x5f, 0xe8, 0x6d,
+	0xdb, 0x66, 0xe6, 0x6d, 0xce, 0xd9, 0x67, 0xcc, 0xd3, 0xde, 0x4e, 0xdc, 0xe8, 0x4f, 0xf2, 0xce,
+	0xfb, 0x4e, 0x5f, 0xd9, 0xcd, 0xe2, 0xdd, 0x4e, 0x58, 0xd5, 0x66, 0xd5, 0x70, 0x54, 0xd4, 0x49,
+	0xcf, 0xe1, 0x5d, 0x4c, 0x5b, 0x58, 0xde, 0x57, 0xce, 0x6c, 0xdc, 0x51, 0x66, 0x6e, 0x4d, 0x5c,
+	0xd9, 0x59, 0xd3, 0xee, 0x4e, 0x75, 0xee, 0x4d, 0xe4, 0x4c, 0x55, 0xd9, 0x6e, 0xeb, 0x50, 0xd3,
+	0x59, 0xe4, 0xea, 0x4d, 0x53, 0x71, 0xf4, 0xd4, 0x57, 0x50, 0xd8, 0xe0, 0xea, 0x7c, 0x4c, 0x5d,
+	0x5c, 0xd6, 0xde, 0x55, 0xf9, 0x4e, 0x5c, 0xd5, 0x6b, 0xf7, 0x60, 0xc9, 0xe0, 0xe4, 0x55, 0x56,
+	0x65, 0xca, 0x75, 0x5d, 0xcd, 0xda, 0x50, 0xd6, 0x57, 0x60, 0xf7, 0xcf, 0xec, 0xf9, 0xd3, 0x5c,
+	0xd1, 0xdd, 0x5e, 0x5a, 0xe6, 0xe5, 0x6a, 0x79, 0xc9, 0x5c, 0xc5, 0x53, 0xe8, 0xd7, 0xce, 0x59,
+	0x6f, 0xc9, 0xe8, 0x54, 0xd2, 0x59, 0xe3, 0xd6, 0x67, 0xcf, 0x50, 0x6b, 0xd1, 0xcd, 0x7e, 0xf9,
+	0xf2, 0x5f, 0x6c, 0xdd, 0x54, 0xcb, 0x69, 0x5f, 0x5f, 0xd7, 0xdc, 0x5a, 0x68, 0xf8, 0x5a, 0xce,
+	0x4e, 0xda, 0xdd, 0xf7, 0x4b, 0x5f, 0x58, 0xcf, 0xec, 0xdb, 0x4a, 0xdc, 0x58, 0xef, 0xdc, 0x4e,
+	0xee, 0x4d, 0x54, 0xee, 0x5d, 0xd6, 0x76, 0x56, 0x57, 0xed, 0xd9, 0x75, 0xec, 0x56, 0xeb, 0x50,
+	0xd9, 0x52, 0xe3, 0x7a, 0x5d, 0x56, 0x57, 0x74, 0xd8, 0x71, 0x70, 0x59, 0x5d, 0xdf, 0x52, 0x5b,
+	0xde, 0xd3, 0x4b, 0x60, 0xdc, 0x70, 0xd9, 0x73, 0x7b, 0x50, 0xfc, 0x77, 0xe4, 0x69, 0x5e, 0xcb,
+	0x7c, 0x76, 0x67, 0x61, 0xee, 0xce, 0xd5, 0xe8, 0xe1, 0xe4, 0x5f, 0x5e, 0x5c, 0xce, 0x6e, 0xdf,
+	0x5f, 0xed, 0x5e, 0xdc, 0x6f, 0xd8, 0xcb, 0xea, 0x62, 0x5d, 0x6f, 0xcf, 0x5c, 0xc7, 0x61, 0xdc,
+	0x63, 0xd5, 0xdd, 0xd9, 0xec, 0x69, 0xde, 0x5f, 0x59, 0x67, 0xfd, 0xdc, 0xdf, 0xce, 0xe1, 0xde,
+	0x4f, 0x58, 0xdb, 0xf3, 0xdf, 0xd9, 0xf4, 0x7c, 0x4e, 0xd7, 0x53, 0xd0, 0x5e, 0x69, 0x7e, 0xd1,
+	0x59, 0xe0, 0xdb, 0x4b, 0xfb, 0x55, 0x63, 0xfe, 0xcd, 0xec, 0x4b, 0xd4, 0x66, 0x4d, 0xe1, 0x66,
+	0xef, 0xd9, 0x4c, 0x61, 0xf7, 0xe7, 0x53, 0xda, 0x5a, 0x4f, 0xcf, 0x59, 0x56, 0xe8, 0xe5, 0x59,
+	0x5d, 0xec, 0xee, 0x68, 0x7e, 0xf7, 0x4e, 0xd8, 0x7d, 0x5d, 0x4e, 0x6c, 0xe4, 0xf8, 0x59, 0xdc,
+	0x50, 0xd1, 0x57, 0xd7, 0x6b, 0x54, 0x62, 0x73, 0x5f, 0xe4, 0xe3, 0x5d, 0xee, 0xda, 0xdc, 0xea,
+	0x4f, 0xfb, 0x7c, 0x79, 0xcd, 0x7a, 0xf0, 0x5d, 0x7a, 0xd2, 0xed, 0xe1, 0x6f, 0x53, 0xce, 0x58,
+	0x6f, 0xe6, 0xda, 0xe4, 0xf4, 0xde, 0x57, 0x78, 0xea, 0xd1, 0xee, 0x67, 0xd6, 0x6e, 0xd6, 0x5c,
+	0x5f, 0xce, 0x60, 0xcf, 0xec, 0x77, 0x5b, 0xd0, 0x58, 0xd8, 0x7c, 0xdd, 0x5b, 0xde, 0xef, 0x5e,
+	0x69, 0xe9, 0xd7, 0x5f, 0x77, 0xf8, 0xd6, 0xd0, 0x57, 0xef, 0x5d, 0x72, 0x73, 0xd7, 0xee, 0xd8,
+	0x77, 0x4f, 0xd2, 0x5d, 0xdf, 0xe0, 0x5a, 0xef, 0xfe, 0x4d, 0xe9, 0xe5, 0xed, 0x4c, 0xf3, 0x6d,
+	0xd9, 0x4e, 0x6a, 0x7d, 0xf6, 0x5d, 0x5f, 0xdc, 0xdd, 0x56, 0x77, 0x5f, 0x5a, 0xd4, 0x6e, 0xe3,
+	0x7d, 0x56, 0x6f, 0x68, 0xe4, 0x4a, 0x7d, 0xde, 0x5c, 0x51, 0xfd, 0xe8, 0xda, 0x50, 0x5f, 0x6d,
+	0x66, 0xef, 0xd7, 0x69, 0x5e, 0xd6, 0x61, 0x59, 0xdb, 0x58, 0xe0, 0x57, 0xe0, 0xdd, 0x5e, 0x73,
+	0xdd, 0xe6, 0xeb, 0x61, 0xda, 0x66, 0x67, 0x5c, 0xd7, 0x7a, 0xdd, 0xdb, 0x5a, 0x70, 0xde, 0xdb,
+	0xe1, 0x5b, 0x60, 0xde, 0xdb, 0xdf, 0x5a, 0xff, 0xe7, 0x6a, 0x66, 0xda, 0x7d, 0xdc, 0x7b, 0xe3,
+	0xd3, 0x57, 0xfd, 0x65, 0xd4, 0xd4, 0xde, 0xdd, 0x53, 0x5e, 0xda, 0xdd, 0xdd, 0xfd, 0x58, 0xf7,
+	0xe7, 0xde, 0xdf, 0xe2, 0xeb, 0x69, 0x73, 0x62, 0xe9, 0x64, 0xda, 0x5b, 0xf8, 0x6a, 0xef, 0xe7,
+	0x5e, 0xf9, 0xef, 0xe9, 0x7c, 0xef, 0x53, 0xfc, 0xf8, 0xdd, 0x74, 0x57, 0x64, 0x61, 0x6f, 0x7b,
+	0xdc, 0x6d, 0xdc, 0x64, 0xed, 0x6d, 0xec, 0x56, 0x5d, 0xdf, 0x6e, 0x5e, 0xe8, 0x54, 0x5d, 0xeb,
+	0xe3, 0x5e, 0x52, 0xe5, 0xdc, 0x6b, 0x4f, 0x71, 0xd4, 0x59, 0xed, 0x57, 0xe8, 0x71, 0x56, 0xd1,
+	0x57, 0xff, 0x62, 0xe2, 0x5d, 0x5e, 0xd4, 0xdb, 0x53, 0xdc, 0x51, 0xd5, 0x54, 0x64, 0xda, 0xf8,
+	0x73, 0xe0, 0xde, 0xfb, 0x54, 0xdd, 0xdf, 0x7a, 0x6e, 0xde, 0x5c, 0xde, 0xf8, 0xfa, 0x63, 0x66,
+	0xda, 0x64, 0x60, 0x7d, 0xd5, 0x5d, 0x6f, 0xd3, 0xee, 0x62, 0x76, 0xdd, 0xd4, 0x5c, 0xd0, 0x57,
+	0xcf, 0x65, 0xf7, 0xeb, 0xfb, 0x76, 0xe7, 0xe9, 0xe7, 0x79, 0x69, 0xdd, 0x5e, 0x77, 0xe5, 0xde,
+	0x64, 0xce, 0xe9, 0x6f, 0xf6, 0x69, 0x5d, 0xd0, 0x7c, 0xdc, 0x5f, 0x5f, 0xdf, 0xd9, 0x55, 0xee,
+	0x5a, 0xe0, 0xfd, 0x72, 0xd8, 0x68, 0x6a, 0xe3, 0xe4, 0x52, 0x5d, 0xd3, 0xfe, 0xf9, 0xe8, 0xf9,
+	0x5d, 0x54, 0xec, 0x63, 0xf3, 0x69, 0x6d, 0x7b, 0xee, 0x61, 0xed, 0x50, 0x5f, 0xde, 0x66, 0xdb,
+	0x62, 0xf0, 0x5a, 0xec, 0x7e, 0x68, 0xec, 0x56, 0x79, 0x61, 0xe5, 0xde, 0x79, 0x5e, 0x51, 0x69,
+	0x68, 0x78, 0xd2, 0xec, 0x67, 0x56, 0x6a, 0xe2, 0xe2, 0xf4, 0x6f, 0xe4, 0x60, 0x56, 0x75, 0x70,
+	0xd5, 0xe5, 0x78, 0x5d, 0xde, 0x5a, 0xda, 0x64, 0x68, 0xf7, 0xdb, 0xed, 0xe4, 0x52, 0xd4, 0x66,
+	0xda, 0xf7, 0x6a, 0x72, 0xdc, 0xe5, 0x5f, 0xdb, 0xe1, 0x6d, 0x58, 0x7e, 0xec, 0x5f, 0xdb, 0x7e,
+	0xd4, 0x66, 0x5f, 0xce, 0xe2, 0xfe, 0x6e, 0x7c, 0xf1, 0x6d, 0xd6, 0x5c, 0xe4, 0x5e, 0xd1, 0x65,
+	0x6c, 0xd8, 0x5e, 0xf2, 0x67, 0xeb, 0x71, 0xd2, 0x65, 0xf7, 0xd9, 0x59, 0xde, 0x5b, 0xd5, 0x5d,
+	0xda, 0x64, 0xe6, 0xee, 0x65, 0x5f, 0xef, 0xed, 0x5a, 0x66, 0xd7, 0x5b, 0x6f, 0x74, 0xda, 0x59,
+	0xde, 0x5c, 0x6c, 0xed, 0xe8, 0x7a, 0x60, 0xe5, 0x6f, 0xdd, 0x55, 0x72, 0xea, 0xeb, 0x59, 0xea,
+	0x5a, 0x5f, 0xe6, 0xde, 0x7f, 0x4f, 0x74, 0xe5, 0xf2, 0xf9, 0x4f, 0x5e, 0xe9, 0x69, 0xe6, 0xed,
+	0x68, 0x58, 0xf7, 0xeb, 0x7e, 0x5e, 0xe2, 0x7d, 0xf6, 0x76, 0x5f, 0xdd, 0x69, 0x5a, 0x76, 0xd9,
+	0x6e, 0xe7, 0x5d, 0xf8, 0x79, 0xf2, 0xe5, 0xe4, 0x67, 0x59, 0xd6, 0xdf, 0xfb, 0x62, 0xdc, 0xee,
+	0xed, 0x5d, 0xfc, 0x5e, 0x6f, 0xe9, 0x7e, 0x6d, 0x6d, 0xcf, 0x61, 0xef, 0x6e, 0xe5, 0xda, 0x6c,
+	0xea, 0x62, 0xd3, 0xdb, 0x6f, 0x60, 0xf3, 0xf3, 0x61, 0x77, 0xfd, 0xd5, 0xda, 0x6c, 0x73, 0x65,
+	0xe3, 0xdf, 0x6a, 0xd8, 0xdf, 0x5b, 0xdd, 0xff, 0x68, 0x75, 0x70, 0x60, 0xdd, 0x79, 0xe2, 0xf9,
+	0x7d, 0xef, 0x59, 0x6d, 0xe0, 0xe5, 0x5f, 0xec, 0x6d, 0xd8, 0x7b, 0xee, 0xfc, 0xff, 0xf2, 0x54,
+	0x5b, 0xf0, 0x6f, 0x72, 0x67, 0xd7, 0x5c, 0xec, 0x5b, 0x60, 0xd3, 0x64, 0xee, 0x5b, 0x6d, 0xdb,
+	0x5c, 0x7f, 0x77, 0x7e, 0xfe, 0x61, 0x5c, 0x72, 0xd6, 0xef, 0x56, 0xe4, 0xfb, 0x5e, 0xfa, 0x61,
+	0xdf, 0x55, 0x66, 0xea, 0xf2, 0xf9, 0xec, 0x6a, 0x65, 0xdc, 0x57, 0x7b, 0xf8, 0xe0, 0x58, 0xd8,
+	0x6a, 0x59, 0x7d, 0xeb, 0xde, 0x67, 0xeb, 0x62, 0xf3, 0xf6, 0x61, 0x6c, 0x70, 0xf9, 0xe1, 0xd4,
+	0xf2, 0x79, 0xf5, 0xe8, 0xe7, 0x54, 0xdf, 0x5f, 0xdb, 0x66, 0xe4, 0xe4, 0xe5, 0xf3, 0xea, 0x78,
+	0xfa, 0x64, 0x6a, 0xf2, 0x70, 0x71, 0xdd, 0x74, 0xda, 0x63, 0x6d, 0xdb, 0xda, 0x5b, 0xdc, 0x7d,
+	0xec, 0xe5, 0x5a, 0x65, 0xd4, 0x60, 0xe1, 0x77, 0x69, 0x6c, 0xe8, 0xec, 0x69, 0xe3, 0xe0, 0x5b,
+	0xf9, 0xdd, 0xe1, 0xfe, 0x6a, 0x74, 0x6f, 0x64, 0x7e, 0xd7, 0x7b, 0xe6, 0x6d, 0x5d, 0xfd, 0x67,
+	0x5f, 0xe3, 0xe0, 0xea, 0x57, 0x60, 0xeb, 0x7d, 0xe4, 0x5a, 0xe2, 0xe5, 0x7c, 0x5c, 0xfd, 0x68,
+	0x61, 0x6a, 0x7a, 0x73, 0xe9, 0xfe, 0x72, 0xf1, 0x58, 0xe7, 0x5e, 0xd9, 0x73, 0x6c, 0x5d, 0xe8,
+	0xdf, 0x5d, 0xf8, 0x69, 0x5d, 0xfc, 0x72, 0xda, 0x60, 0x66, 0x7c, 0xe2, 0x68, 0xdf, 0x61, 0xe5,
+	0xe7, 0x56, 0xf4, 0x7c, 0xe9, 0x6d, 0x5b, 0xde, 0xf0, 0xf0, 0x5b, 0xd9, 0x5d, 0x71, 0xef, 0xf1,
+	0x75, 0xdd, 0x6c, 0xe4, 0xe9, 0x5f, 0x62, 0xd6, 0xf8, 0x71, 0x69, 0xdf, 0xfe, 0x63, 0xd8, 0xe6,
+	0x5a, 0xfb, 0xe4, 0xe2, 0xe6, 0x66, 0x5f, 0xdb, 0xf7, 0x5e, 0xed, 0xdd, 0xef, 0xf0, 0xe0, 0xf9,
+	0xf0, 0x67, 0xef, 0xf9, 0xe3, 0xf0, 0xfa, 0x5b, 0x6c, 0xf4, 0xe5, 0xec, 0x73, 0x60, 0xd9, 0xfb,
+	0xe4, 0x5f, 0xef, 0x66, 0xe1, 0x5b, 0x6b, 0x69, 0xd7, 0xdf, 0x6d, 0xe3, 0xf7, 0x5e, 0x77, 0x66,
+	0xe8, 0xeb, 0x65, 0x6f, 0x7d, 0x78, 0x6f, 0x7d, 0x6d, 0x74, 0x65, 0xdb, 0x67, 0xf6, 0x67, 0x64,
+	0xdd, 0x79, 0xf2, 0x69, 0x5d, 0x60, 0xdd, 0x5e, 0xe2, 0x6d, 0x68, 0x72, 0xe3, 0xeb, 0x5d, 0xfc,
+	0x65, 0xf8, 0x67, 0xe1, 0x59, 0xf8, 0x73, 0xe7, 0x5d, 0x67, 0xef, 0xe5, 0x5f, 0xeb, 0x74, 0xe6,
+	0xe3, 0x59, 0xdf, 0x6f, 0xf5, 0x5f, 0x6b, 0xdd, 0xf1, 0xe9, 0x6b, 0xec, 0xef, 0x6d, 0x63, 0xf8,
+	0x7d, 0x7d, 0x67, 0xf9, 0xdd, 0x65, 0xde, 0xf4, 0x5e, 0xee, 0xfc, 0xee, 0xdf, 0x5e, 0xdb, 0xe4,
+	0xf3, 0xef, 0x5d, 0x68, 0xf1, 0xf9, 0xdb, 0xf8, 0xfc, 0xe8, 0xeb, 0x64, 0x6c, 0xff, 0x6f, 0xe1,
+	0x60, 0x75, 0xd6, 0xef, 0xf8, 0xe2, 0x5e, 0x6c, 0xf7, 0xfe, 0xf8, 0xe7, 0x7e, 0x62, 0xdf, 0xee,
+	0x6c, 0xed, 0x7b, 0x60, 0xfe, 0xd8, 0x69, 0x64, 0xd9, 0xed, 0x5e, 0x60, 0x78, 0xdf, 0xdf, 0x62,
+	0x5e, 0x76, 0xdb, 0x5f, 0x6b, 0xd9, 0x6a, 0x62, 0xe9, 0xe1, 0x5b, 0xe0, 0xfd, 0x79, 0x58, 0x7d,
+	0xe8, 0xed, 0x5e, 0x5f, 0xdf, 0x64, 0xeb, 0xee, 0x74, 0x59, 0x6e, 0x6e, 0xf4, 0xdf, 0x64, 0x5e,
+	0xda, 0x79, 0x62, 0xec, 0x68, 0xe6, 0xf5, 0x75, 0x5e, 0xe8, 0xff, 0x6b, 0x6a, 0xe6, 0x71, 0x69,
+	0xef, 0x62, 0xe7, 0x70, 0x7b, 0xed, 0x7b, 0xef, 0x76, 0xf5, 0x64, 0xfe, 0x5e, 0xf7, 0xdb, 0x5e,
+	0x7b, 0x68, 0xdc, 0xeb, 0x7c, 0x7e, 0xe0, 0x7e, 0x67, 0xe3, 0xef, 0x6c, 0x6e, 0xed, 0xf8, 0x73,
+	0x7c, 0x6d, 0xf7, 0xe3, 0xe0, 0x60, 0xde, 0x61, 0xe3, 0xf8, 0xf3, 0x67, 0x6f, 0xde, 0x66, 0xfe,
+	0x7a, 0xeb, 0x7a, 0xfe, 0xdf, 0x78, 0x7d, 0xdc, 0x7e, 0xe2, 0x5e, 0xed, 0x70, 0x64, 0x7b, 0x72,
+	0xde, 0x6b, 0xd8, 0x62, 0xeb, 0x78, 0xdf, 0x5d, 0xf0, 0x65, 0xfa, 0xf8, 0xdd, 0xef, 0xf8, 0xef,
+	0x78, 0x65, 0x5f, 0xde, 0x5b, 0xe3, 0x5d, 0x74, 0xf8, 0x68, 0xe7, 0x76, 0x73, 0xde, 0xee, 0x7e,
+	0x5f, 0x76, 0xf5, 0xec, 0x6b, 0x5d, 0xe6, 0x5f, 0x6c, 0xed, 0x67, 0xeb, 0x72, 0xe3, 0x63, 0x64,
+	0xde, 0xee, 0x61, 0x6e, 0x6f, 0xf8, 0x6c, 0x72, 0xee, 0xec, 0x6d, 0x60, 0xf2, 0xea, 0x60, 0xeb,
+	0xe6, 0x5e, 0x6f, 0x73, 0xef, 0x68, 0xdf, 0x6c, 0xea, 0x7d, 0xee, 0xec, 0x5f, 0x73, 0xe3, 0xf9,
+	0x78, 0x6a, 0x74, 0x63, 0xed, 0xdc, 0xf1, 0xed, 0x7d, 0xec, 0xf4, 0xf9, 0x58, 0x73, 0xf5, 0x7e,
+	0xde, 0x5e, 0x70, 0x79, 0xdc, 0xdf, 0x5e, 0xea, 0x69, 0xdc, 0xe7, 0x7c, 0xea, 0xfd, 0x7b, 0x6d,
+	0x63, 0x75, 0xdf, 0x65, 0xe8, 0x74, 0xdd, 0x7e, 0xe8, 0x5c, 0x6b, 0x73, 0xd7, 0xe4, 0xee, 0x6e,
+	0x5e, 0xdd, 0x5f, 0xf8, 0xde, 0x6a, 0x62, 0xdc, 0x69, 0xee, 0x71, 0x77, 0xe5, 0xf4, 0x78, 0xea,
+	0x6a, 0x70, 0xff, 0xed, 0x6f, 0x72, 0xfa, 0x65, 0xe1, 0x61, 0x6d, 0xe8, 0x7c, 0xf5, 0x62, 0xf6,
+	0xe5, 0x61, 0xf0, 0xf7, 0x7d, 0xf5, 0x68, 0xfe, 0x74, 0xfd, 0xf4, 0x61, 0x78, 0xf0, 0x64, 0x7f,
+	0xec, 0x70, 0xf0, 0x6d, 0xfd, 0x76, 0xef, 0x6d, 0x63, 0x69, 0xf0, 0x65, 0x70, 0xdc, 0x79, 0xec,
+	0xf9, 0x7c, 0x67, 0x6e, 0x70, 0x6b, 0x6c, 0x7e, 0xdd, 0x74, 0x64, 0xef, 0xdf, 0x67, 0xf4, 0xed,
+	0x5e, 0xe0, 0xf8, 0x60, 0xfd, 0xe6, 0xe8, 0x77, 0x61, 0x69, 0xed, 0xe2, 0x75, 0xea, 0xf0, 0xf2,
+	0x5f, 0xea, 0x7a, 0xe3, 0x6c, 0xe4, 0x6e, 0x70, 0x73, 0x6f, 0xde, 0xe9, 0xff, 0x6c, 0xe9, 0xf3,
+	0xe6, 0x5d, 0xfb, 0xec, 0x75, 0x6a, 0xf0, 0xe0, 0xf8, 0xe8, 0xef, 0x69, 0x71, 0x69, 0x6c, 0xfa,
+	0xda, 0xe8, 0x5e, 0x6d, 0x7f, 0xe1, 0xfc, 0x6d, 0x70, 0x7d, 0xe9, 0xeb, 0x66, 0xde, 0x73, 0xfc,
+	0x67, 0x72, 0x6b, 0x70, 0xe9, 0x6f, 0xea, 0xe1, 0x7c, 0xea, 0x6d, 0x6e, 0x62, 0x6b, 0xdf, 0xf6,
+	0xf6, 0x6d, 0x75, 0xfd, 0x60, 0xf4, 0x64, 0xed, 0xf3, 0xee, 0xec, 0x68, 0xec, 0xfc, 0x5f, 0x6c,
+	0x6b, 0x67, 0xf0, 0xf4, 0xef, 0xea, 0xf8, 0x6c, 0x6b, 0xec, 0x66, 0x63, 0x73, 0x75, 0x7d, 0x7c,
+	0x7a, 0xed, 0x7e, 0xff, 0x6e, 0xe2, 0xf1, 0x71, 0x6c, 0x78, 0x78, 0xe3, 0xff, 0x7b, 0x7c, 0x7b,
+	0x5f, 0xf0, 0xeb, 0x7c, 0x74, 0xef, 0x6a, 0xed, 0x79, 0xf5, 0xea, 0xff, 0xec, 0x75, 0x67, 0x7c,
+	0x68, 0xef, 0xf0, 0xfc, 0xdf, 0x73, 0x6e, 0xe7, 0xed, 0x6c, 0xeb, 0xf8, 0xfc, 0x65, 0x77, 0x76,
+	0xe4, 0xee, 0x7b, 0xf5, 0xee, 0x64, 0x78, 0x6f, 0xf0, 0xf4, 0xf2, 0xde, 0x76, 0xef, 0x6b, 0xf6,
+	0xee, 0x66, 0x7d, 0x7f, 0x72, 0xe7, 0xf0, 0xef, 0x67, 0x77, 0xec, 0x69, 0xfd, 0x7d, 0x75, 0x7b,
+	0xdf, 0x70, 0xea, 0xed, 0x62, 0xe3, 0xf1, 0x72, 0x6a, 0x6f, 0x7d, 0xea, 0xec, 0x5e, 0x67, 0xec,
+	0xec, 0x70, 0x7a, 0x6a, 0xee, 0x6f, 0xe6, 0x64, 0x65, 0xdf, 0x79, 0x6b, 0xff, 0xf6, 0x6b, 0xe4,
+	0xee, 0x5e, 0x66, 0xea, 0x7d, 0x66, 0xf8, 0xf5, 0x66, 0x76, 0xf6, 0x6c, 0xfa, 0xe5, 0x63, 0xe4,
+	0x60, 0xe3, 0xfb, 0x70, 0x63, 0x79, 0xec, 0xf6, 0xe8, 0x64, 0x7d, 0xec, 0x73, 0x69, 0x69, 0xf8,
+	0xe4, 0x6a, 0x7d, 0xed, 0x6b, 0xe4, 0x6c, 0xe4, 0x63, 0x78, 0xf0, 0xee, 0x71, 0x6b, 0xf1, 0xe0,
+	0xe7, 0x6c, 0x63, 0xfa, 0x6e, 0x76, 0xe5, 0xe8, 0xe4, 0xec, 0x5f, 0xe4, 0xec, 0xfe, 0xf1, 0x73,
+	0xf3, 0x67, 0xf6, 0x64, 0x6d, 0xe0, 0xfe, 0x6d, 0xe9, 0x69, 0xde, 0xe6, 0xfa, 0x6a, 0x69, 0x72,
+	0xe8, 0xe8, 0x67, 0xe0, 0x6b, 0xee, 0x66, 0xe5, 0x6b, 0xe4, 0xec, 0x5f, 0x6e, 0xf5, 0xe8, 0x72,
+	0x6d, 0x6b, 0xdf, 0xea, 0xfa, 0x6c, 0x73, 0x71, 0x70, 0xf1, 0xf4, 0x79, 0xef, 0x6f, 0x69, 0xef,
+	0xf6, 0x7e, 0x75, 0x7f, 0xfa, 0x7e, 0x66, 0xe4, 0xfa, 0x60, 0x76, 0xec, 0x66, 0xe5, 0x7b, 0xf6,
+	0x63, 0x69, 0xee, 0xed, 0x62, 0xe6, 0xf4, 0x65, 0x6d, 0xe6, 0x69, 0x71, 0xe4, 0x5f, 0xe9, 0x6b,
+	0x6f, 0xfd, 0xe3, 0xf4, 0xfd, 0x73, 0x7b, 0x5f, 0x6f, 0xe8, 0x73, 0xed, 0x69, 0xef, 0x6a, 0xf5,
+	0xf6, 0xeb, 0x76, 0xf2, 0x6d, 0xed, 0x6d, 0x76, 0x7e, 0xe3, 0x60, 0xee, 0xe5, 0xf6, 0x5f, 0xfe,
+	0x74, 0xef, 0x78, 0xe7, 0x76, 0xe9, 0x68, 0x7e, 0xea, 0xee, 0xf6, 0x6c, 0x6f, 0xf9, 0x73, 0xdf,
+	0x69, 0xf0, 0x76, 0x6c, 0xf1, 0xe7, 0xef, 0xec, 0x7d, 0x64, 0xfa, 0xf2, 0xf5, 0xf7, 0x73, 0x7a,
+	0x7e, 0x79, 0x7d, 0x75, 0xdd, 0xed, 0x61, 0x7a, 0x7e, 0xe9, 0x76, 0xf9, 0xe7, 0x77, 0x68, 0xeb,
+	0xf9, 0x7d, 0xe9, 0x63, 0x6d, 0xfb, 0xf8, 0x7a, 0xf0, 0xfd, 0xf1, 0x67, 0xf8, 0xe8, 0x6a, 0x67,
+	0x74, 0xf7, 0xe3, 0xfb, 0xf8, 0x60, 0xee, 0x7c, 0xed, 0x63, 0x6b, 0x6e, 0xf9, 0xef, 0x7b, 0xe6,
+	0x65, 0x6d, 0x6d, 0xe5, 0x7c, 0x75, 0xfb, 0x69, 0xed, 0xf4, 0xeb, 0xf9, 0x5f, 0xeb, 0x6b, 0x72,
+	0x6a, 0xef, 0xe8, 0x64, 0xf6, 0xf6, 0xfa, 0x64, 0x77, 0xed, 0x7a, 0x77, 0xfe, 0x7d, 0xed, 0x72,
+	0xf8, 0x6d, 0xf6, 0x70, 0xf1, 0xec, 0xf4, 0x67, 0x6c, 0xf9, 0xea, 0x6f, 0xe2, 0x72, 0xe9, 0x7e,
+	0x6c, 0x75, 0x6b, 0xfd, 0xf7, 0xe9, 0x78, 0xef, 0x68, 0xee, 0xe7, 0xfe, 0x7e, 0x7c, 0x68, 0x7c,
+	0xee, 0xec, 0xf0, 0x69, 0xf1, 0xed, 0xed, 0x73, 0x67, 0xfa, 0xf1, 0xea, 0x6a, 0x7b, 0xe4, 0xf5,
+	0x64, 0xe6, 0x7c, 0xea, 0x6b, 0x7a, 0x74, 0xe7, 0x6a, 0xf1, 0xf3, 0x68, 0xe4, 0xf7, 0x6b, 0xeb,
+	0x68, 0xed, 0xee, 0x6d, 0xef, 0x69, 0xe9, 0xee, 0x6a, 0xed, 0x66, 0xee, 0x74, 0xf4, 0x7a, 0x66,
+	0xec, 0x6d, 0x76, 0xf9, 0x6e, 0x7b, 0xea, 0x79, 0xe9, 0x74, 0xef, 0x6a, 0x69, 0x6f, 0x6f, 0xe6,
+	0xec, 0x6b, 0xef, 0x67, 0x74, 0xfe, 0x6f, 0x7d, 0x7e, 0x70, 0xfb, 0xf8, 0x70, 0xf3, 0x72, 0xef,
+	0x6a, 0x73, 0x7d, 0xe7, 0xed, 0x66, 0xe6, 0x65, 0x6e, 0xe2, 0x7a, 0xfe, 0x7b, 0xfb, 0x7c, 0xef,
+	0x6b, 0x72, 0xe9, 0xef, 0x6a, 0x6f, 0x6b, 0x73, 0xea, 0x70, 0x78, 0xf6, 0x74, 0xf4, 0xee, 0xfb,
+	0x78, 0xe4, 0x6e, 0xed, 0xfd, 0x6d, 0x6f, 0xf5, 0x7f, 0xf6, 0xef, 0x75, 0xef, 0x7d, 0xf6, 0xfd,
+	0xed, 0x7c, 0x6e, 0xef, 0x74, 0x78, 0xfc, 0x6d, 0xf6, 0xfb, 0xe4, 0x70, 0xf1, 0x6c, 0x7c, 0xe5,
+	0x6f, 0x6f, 0xe1, 0xfb, 0xf0, 0xf0, 0x79, 0x7c, 0xfe, 0x68, 0xfb, 0xeb, 0x69, 0x7a, 0xf6, 0xf3,
+	0xea, 0x6a, 0x7c, 0x6c, 0xeb, 0x6e, 0xf1, 0xea, 0x69, 0xf2, 0xfb, 0x79, 0xef, 0x7c, 0x75, 0xec,
+	0x7e, 0x6d, 0x69, 0x6f, 0xed, 0xeb, 0x7e, 0xfb, 0xf9, 0x6b, 0xf3, 0x6c, 0x7e, 0xf9, 0xfb, 0xf2,
+	0x78, 0xfa, 0x70, 0xf0, 0x60, 0x74, 0xea, 0xf4, 0x6d, 0x6c, 0x6e, 0xe4, 0x6d, 0x70, 0x7c, 0xf8,
+	0xe9, 0xf2, 0x6f, 0x75, 0xff, 0x6d, 0x7c, 0x79, 0xeb, 0x6f, 0x68, 0xf9, 0x74, 0xe4, 0xf4, 0x73,
+	0xf4, 0x6c, 0x6c, 0x7e, 0xea, 0x7c, 0xec, 0xfa, 0x65, 0xf0, 0xf8, 0x7c, 0x73, 0x6d, 0xec, 0x76,
+	0xf3, 0x6d, 0x7d, 0xf9, 0xe8, 0x65, 0xf5, 0xfd, 0x74, 0xfc, 0xe8, 0x79, 0xf5, 0x72, 0xe8, 0x68,
+	0xf0, 0xf1, 0xee, 0x6d, 0x76, 0x6f, 0x74, 0xea, 0xea, 0xf5, 0xf1, 0xf6, 0x6a, 0x75, 0xfd, 0xed,
+	0x7c, 0x69, 0xe9, 0xf5, 0xfd, 0xf2, 0x66, 0xfa, 0x7f, 0xee, 0xf5, 0xef, 0x7b, 0x6a, 0x6f, 0xed,
+	0xfe, 0xf0, 0x69, 0xf1, 0xec, 0xf6, 0xf8, 0x76, 0x7c, 0x67, 0x6f, 0xf0, 0xf4, 0xec, 0x6c, 0xfe,
+	0xf3, 0x79, 0x7c, 0xec, 0xf6, 0x62, 0xea, 0x73, 0x76, 0x6f, 0xf1, 0xef, 0x6d, 0x6a, 0x7d, 0xfa,
+	0xee, 0x7f, 0xfd, 0xf3, 0x68, 0xf7, 0xf6, 0x67, 0x73, 0x6f, 0xea, 0xf6, 0x68, 0xe7, 0x6d, 0x77,
+	0xec, 0xf7, 0x69, 0x6c, 0x7c, 0x7c, 0xf8, 0x71, 0xfb, 0x7f, 0x76, 0xe6, 0xfc, 0xf3, 0x71, 0x6e,
+	0x77, 0x75, 0xec, 0xf0, 0x6c, 0x6f, 0xf5, 0xed, 0x69, 0xea, 0xf6, 0x76, 0xef, 0xfc, 0x75, 0x6f,
+	0xf4, 0xfb, 0x67, 0x7e, 0xfd, 0xff, 0xef, 0xec, 0xf0, 0x6d, 0x6f, 0x6f, 0xfb, 0xef, 0xf8, 0xec,
+	0x7e, 0x75, 0x6b, 0xf5, 0x7d, 0xe9, 0xf5, 0x72, 0xf9, 0x6b, 0xeb, 0xed, 0xf3, 0xf8, 0x67, 0xee,
+	0x7c, 0x69, 0x7d, 0xeb, 0x7a, 0x78, 0xfe, 0xfa, 0xed, 0x7a, 0xed, 0xfc, 0x74, 0xed, 0x6b, 0xf3,
+	0x77, 0x75, 0x6f, 0xf9, 0xe7, 0x6b, 0xfe, 0xf7, 0x7b, 0x6f, 0xfc, 0xf3, 0xf2, 0xfb, 0x6a, 0xf1,
+	0x72, 0xe9, 0x79, 0x6a, 0xf9, 0xff, 0x7a, 0xf9, 0xee, 0x7c, 0x7e, 0x6d, 0xfb, 0xf6, 0x6d, 0xed,
+	0xf9, 0x6d, 0x6f, 0x6f, 0xf0, 0xee, 0x7c, 0x6c, 0x70, 0xf8, 0xf9, 0xee, 0x6b, 0xfe, 0xf1, 0x6b,
+	0x71, 0xed, 0x6d, 0xfb, 0xf2, 0x70, 0xef, 0xef, 0x72, 0x6b, 0xf4, 0xfe, 0xf6, 0x7e, 0xfd, 0x7d,
+	0x77, 0xf9, 0x68, 0xee, 0xee, 0x73, 0xfb, 0x73, 0x7b, 0x72, 0x77, 0xee, 0xee, 0x76, 0xf9, 0x6d,
+	0x71, 0xea, 0x73, 0x73, 0x74, 0xe9, 0xed, 0x6a, 0xfa, 0xfb, 0xec, 0x6b, 0xec, 0xf3, 0x6a, 0xeb,
+	0x6d, 0xfa, 0xf1, 0xf8, 0x7c, 0xf8, 0x6a, 0xeb, 0x78, 0xfb, 0xfd, 0xfb, 0xfc, 0xf0, 0xf3, 0x6b,
+	0x6e, 0xea, 0x7c, 0xfa, 0x70, 0x71, 0xff, 0x79, 0xe6, 0xf4, 0xf4, 0x74, 0xf9, 0x7e, 0xff, 0x6c,
+	0x74, 0xf7, 0x75, 0xfb, 0xec, 0x70, 0xee, 0xf4, 0x7e, 0x6b, 0xed, 0x6e, 0xf9, 0xf0, 0x6b, 0xed,
+	0x74, 0x6f, 0x78, 0xe6, 0x7d, 0x76, 0xf3, 0xf8, 0x76, 0xf4, 0xfb, 0xfb, 0x73, 0x6a, 0x6f, 0xef,
+	0xf6, 0xf5, 0xf8, 0x6b, 0x6d, 0x7b, 0x77, 0xef, 0xef, 0xf3, 0x64, 0x7a, 0xf1, 0x6f, 0x73, 0x74,
+	0xfb, 0xf8, 0x6f, 0xf8, 0xec, 0x6a, 0xfd, 0x72, 0xf3, 0xf8, 0xf2, 0xf4, 0x67, 0x72, 0xed, 0xfc,
+	0x79, 0xf8, 0x72, 0xf2, 0x79, 0xfa, 0x6f, 0xf1, 0x7c, 0x72, 0xef, 0xf5, 0x6a, 0xeb, 0x6f, 0x70,
+	0xf9, 0x7e, 0xed, 0x6c, 0xec, 0xfc, 0x75, 0x7f, 0xff, 0x6f, 0x7a, 0xe7, 0x7e, 0x7e, 0x72, 0xfb,
+	0x77, 0xe8, 0xef, 0x6d, 0x73, 0xfd, 0xea, 0x72, 0x7b, 0xf2, 0xfa, 0x6c, 0xff, 0xf4, 0x7b, 0xfa,
+	0x72, 0x77, 0xfe, 0xfc, 0xed, 0x7b, 0x77, 0xe7, 0xfb, 0x6d, 0xec, 0x79, 0x74, 0xfc, 0xec, 0xef,
+	0x7e, 0x75, 0x6f, 0xeb, 0x75, 0x71, 0x76, 0x7c, 0xf5, 0xed, 0x7a, 0x6d, 0xfb, 0xec, 0x6f, 0x6f,
+	0xef, 0xf0, 0x78, 0x76, 0x7a, 0x73, 0xed, 0xf8, 0x78, 0xf6, 0xf6, 0x70, 0x77, 0x7c, 0x78, 0xed,
+	0x78, 0x6e, 0xf1, 0xfb, 0xfd, 0xfc, 0xfb, 0x6b, 0x6e, 0xef, 0xf5, 0x6c, 0xfd, 0x7c, 0x7f, 0x7e,
+	0xfc, 0xfb, 0xfd, 0x7c, 0x7f, 0x6e, 0xee, 0xf2, 0x6e, 0x6f, 0x74, 0x77, 0xed, 0x71, 0xec, 0x6c,
+	0xec, 0x7f, 0xf7, 0x6f, 0xf2, 0x78, 0xf2, 0xf7, 0x6e, 0x79, 0xef, 0xfa, 0xfe, 0x6a, 0x70, 0xf6,
+	0xfe, 0x6f, 0xeb, 0x6d, 0xfd, 0xf2, 0x79, 0x71, 0xfb, 0xf0, 0x74, 0xf7, 0xff, 0xec, 0xfc, 0x6f,
+	0x70, 0xf2, 0xf4, 0x74, 0x7b, 0xfa, 0xfb, 0x7e, 0xec, 0x74, 0x77, 0x74, 0xe8, 0xef, 0x7d, 0x7f,
+	0xfc, 0xf4, 0x7b, 0x6c, 0x6f, 0xeb, 0xf4, 0x7b, 0xff, 0x6e, 0xf6, 0xf4, 0x7f, 0xee, 0x7a, 0x71,
+	0x7e, 0xf4, 0x6e, 0xfd, 0xed, 0x7d, 0x6f, 0xf8, 0xfb, 0x71, 0xfe, 0xeb, 0xf3, 0x6c, 0x6e, 0xf7
+};
+
+// ../samples/hat.wav, 2880 frames at 24000 Hz, ulaw
+static const uint8_t drums_zone2[] = {
+	0x1c, 0x98, 0x25, 0x9e, 0xd1, 0x0b, 0x3f, 0x81, 0x0a, 0x4f, 0x83, 0x0c, 0x94, 0x15, 0xa7, 0x0e,
+	0x8e, 0x9e, 0x16, 0xa0, 0x3a, 0x0a, 0x87, 0x27, 0x1b, 0x1c, 0x82, 0x13, 0x9e, 0xa8, 0x28, 0xa2,
+	0x0d, 0x93, 0x16, 0x8e, 0x3f, 0x04, 0xc8, 0xb8, 0x86, 0x0d, 0xa5, 0x19, 0xa3, 0x2e, 0x4a, 0x9f,
+	0x7b, 0x9a, 0x21, 0x9f, 0x3b, 0xad, 0x1a, 0x0e, 0x88, 0xb3, 0x3f, 0x19, 0xac, 0x0f, 0x8b, 0x1e,
+	0x1c, 0x22, 0x86, 0xad, 0x02, 0x88, 0x16, 0x1e, 0xad, 0x91, 0xb4, 0x05, 0x8d, 0x0d, 0x8a, 0x17,
+	0x8e, 0xb5, 0x11, 0x90, 0x0a, 0x22, 0x8f, 0x0e, 0xaa, 0xa5, 0xa6, 0x13, 0x32, 0x86, 0x0e, 0x8c,
+	0x3f, 0x0f, 0xba, 0xc0, 0xb0, 0x46, 0x4c, 0xc0, 0x9c, 0x15, 0x3c, 0x9e, 0x12, 0xbf, 0x8b, 0x14,
+	0xd1, 0x0f, 0x97, 0xac, 0x0f, 0x8e, 0xdc, 0x0f, 0x8f, 0x2c, 0xa6, 0x1c, 0x9b, 0xcf, 0x0b, 0xcc,
+	0x8e, 0x9f, 0x0b, 0xa8, 0xaf, 0x20, 0xca, 0x46, 0xc4, 0xa5, 0x1f, 0xbd, 0x99, 0x0b, 0x91, 0xad,
+	0x18, 0x3b, 0x8f, 0x10, 0x47, 0xa4, 0xa2, 0x0f, 0xa7, 0xe3, 0x94, 0x1a, 0x99, 0x0d, 0xad, 0x9e,
+	0xa6, 0x18, 0x27, 0x38, 0x99, 0x1d, 0x8f, 0xd1, 0x0e, 0xba, 0x93, 0x2e, 0xae, 0x17, 0x28, 0xae,
+	0x95, 0x14, 0xbf, 0xc0, 0xf6, 0x66, 0x95, 0x0c, 0x30, 0x87, 0x44, 0xb9, 0x13, 0x95, 0x59, 0x0e,
+	0x95, 0xbc, 0x2e, 0x32, 0x28, 0xc9, 0x38, 0x2f, 0x96, 0x21, 0x95, 0x0d, 0x8a, 0x2a, 0xa9, 0x56,
+	0xf5, 0x20, 0x14, 0x8e, 0x14, 0xb6, 0x9e, 0x34, 0x39, 0x96, 0x20, 0x25, 0x3e, 0x92, 0x1d, 0xa2,
+	0x1b, 0x31, 0x9f, 0xa5, 0x11, 0x92, 0xb6, 0x39, 0xde, 0x0d, 0x93, 0xa9, 0x0d, 0xab, 0x77, 0xa7,
+	0x3b, 0xcb, 0xa3, 0x0e, 0xca, 0xc3, 0x79, 0x49, 0x8b, 0x39, 0x0e, 0x9d, 0x2e, 0x7b, 0xd1, 0xa5,
+	0x48, 0x2b, 0x31, 0xb6, 0x2d, 0x9c, 0xb3, 0x22, 0x25, 0xbd, 0xae, 0xab, 0xb0, 0x1e, 0x9d, 0x30,
+	0x2f, 0x49, 0xb9, 0xad, 0x27, 0xa8, 0x2b, 0x2d, 0xa7, 0xb4, 0x15, 0xa2, 0xfc, 0x9c, 0xcb, 0x18,
+	0x9a, 0x3d, 0x1a, 0xae, 0x23, 0x93, 0x36, 0xad, 0x3f, 0x3a, 0xc8, 0x33, 0x1d, 0x9c, 0x18, 0xb8,
+	0x96, 0x12, 0xce, 0xee, 0x90, 0x14, 0x36, 0x8f, 0x13, 0x93, 0x34, 0xb5, 0xbc, 0x22, 0xae, 0x12,
+	0x93, 0x2b, 0xaf, 0x18, 0x97, 0xb2, 0x0f, 0xab, 0xad, 0xab, 0x19, 0x4b, 0xc8, 0xa4, 0xba, 0x24,
+	0x5c, 0xda, 0x50, 0xc9, 0x26, 0xa0, 0x9e, 0x1b, 0xa6, 0x1a, 0x9c, 0xca, 0x46, 0x38, 0x58, 0xb7,
+	0xad, 0x14, 0x4e, 0x98, 0xb6, 0x23, 0x48, 0xab, 0x1c, 0xc6, 0x4a, 0xa4, 0x2c, 0x46, 0x9f, 0xad,
+	0x18, 0xa3, 0x2b, 0xa0, 0x2c, 0x29, 0x50, 0x34, 0xa0, 0x43, 0x32, 0xb5, 0x56, 0xa0, 0x1a, 0x93,
+	0x1e, 0xbe, 0x3d, 0xa6, 0x69, 0x2d, 0x49, 0xaf, 0xbc, 0x21, 0xa9, 0xb1, 0x1f, 0x2f, 0xf4, 0x9f,
+	0x55, 0xad, 0x42, 0x1b, 0x50, 0xcc, 0x4b, 0x9f, 0xbb, 0xd6, 0x1b, 0x9c, 0x1e, 0xc2, 0xac, 0x1b,
+	0xf1, 0x98, 0x1e, 0xcd, 0xb3, 0xc6, 0x1a, 0xab, 0xc4, 0xd3, 0x2e, 0xa8, 0xa8, 0x1e, 0xbc, 0x25,
+	0xbb, 0xa7, 0x1e, 0x98, 0xe2, 0x17, 0x96, 0x1e, 0xa7, 0x69, 0x23, 0xa8, 0x62, 0xbc, 0x1f, 0xa2,
+	0xb6, 0x2e, 0x3e, 0x26, 0xa9, 0x3e, 0xaa, 0x59, 0x43, 0x29, 0xa4, 0x6a, 0x25, 0x9b, 0x34, 0x21,
+	0x98, 0x19, 0xb9, 0xa9, 0x42, 0x58, 0xc9, 0x39, 0x3e, 0x3f, 0x45, 0x9d, 0xda, 0x37, 0xb9, 0x2a,
+	0x49, 0xc4, 0xa4, 0x18, 0xa6, 0x32, 0xa3, 0x28, 0x65, 0xce, 0xc0, 0xb6, 0x28, 0xa4, 0x1c, 0xbe,
+	0x3c, 0xec, 0x9e, 0x55, 0x22, 0xf8, 0xb6, 0xae, 0xce, 0x4f, 0x3e, 0x28, 0xb4, 0x39, 0xae, 0xdb,
+	0x2c, 0xd8, 0xa4, 0x1c, 0x9b, 0xcb, 0xd4, 0x22, 0xbd, 0xdf, 0xd7, 0xae, 0x31, 0x2c, 0xa3, 0x2c,
+	0xc6, 0xc4, 0x1d, 0x9c, 0x48, 0x3e, 0xdf, 0x53, 0x34, 0xaf, 0x27, 0xa8, 0xc1, 0x3b, 0xc6, 0xac,
+	0x52, 0x1d, 0x9f, 0x3e, 0x24, 0xb1, 0x45, 0x40, 0xa9, 0xac, 0x22, 0xa5, 0x3e, 0x25, 0x9e, 0x36,
+	0xb0, 0x3b, 0xe6, 0x2d, 0xaa, 0xc6, 0x51, 0x2b, 0xb1, 0x36, 0x2e, 0x53, 0xdf, 0xc7, 0x5d, 0xb0,
+	0xbc, 0x40, 0x49, 0xba, 0x30, 0xc1, 0xb4, 0x2f, 0x3b, 0x9f, 0x3f, 0x2f, 0xf9, 0xc2, 0xd4, 0x2f,
+	0x3b, 0xbc, 0xa6, 0x23, 0xb3, 0x38, 0xee, 0x5e, 0xba, 0x3a, 0x45, 0xcf, 0xd8, 0xb3, 0x2d, 0x5f,
+	0xad, 0x5e, 0xb6, 0x24, 0xb1, 0x76, 0x30, 0x9c, 0x20, 0x49, 0xaf, 0x35, 0xac, 0x38, 0x3c, 0x54,
+	0xa3, 0x2d, 0xaa, 0x34, 0xac, 0x25, 0x5b, 0xed, 0xa9, 0x40, 0x38, 0x3a, 0xa8, 0xb8, 0x31, 0x28,
+	0xe6, 0xd8, 0xd2, 0x48, 0xec, 0xa7, 0xbb, 0x24, 0xa1, 0x2c, 0xb5, 0xcc, 0xe9, 0x1e, 0xba, 0xb7,
+	0xb4, 0x1f, 0xbf, 0xaa, 0x23, 0xba, 0x5b, 0xb4, 0xbc, 0x23, 0xaa, 0x78, 0xce, 0x39, 0xb3, 0x2a,
+	0xdc, 0x42, 0xab, 0x38, 0x3f, 0x4f, 0xab, 0x4d, 0xce, 0x37, 0xcf, 0x36, 0xab, 0x26, 0xaf, 0xba,
+	0x54, 0x2a, 0xc9, 0xa9, 0x41, 0xbe, 0x78, 0x31, 0xaf, 0x46, 0x32, 0xe3, 0x3a, 0xb8, 0xac, 0x21,
+	0xaf, 0x2f, 0x67, 0xab, 0x32, 0x43, 0xcf, 0xae, 0x5b, 0x2b, 0xc0, 0xa6, 0x26, 0xb7, 0x4a, 0xb6,
+	0x46, 0xc5, 0x3e, 0x37, 0x74, 0x51, 0xa6, 0x27, 0x54, 0xa0, 0x26, 0xa8, 0x25, 0xb6, 0x3f, 0xab,
+	0x42, 0xea, 0xce, 0xcf, 0x2e, 0xbe, 0x49, 0x39, 0xa8, 0x3f, 0xc1, 0x2c, 0xb9, 0x58, 0xbe, 0x2b,
+	0xbe, 0xcc, 0x35, 0xb1, 0xc7, 0x3b, 0xc2, 0x62, 0x36, 0xcd, 0xab, 0x2b, 0xd4, 0x39, 0xcd, 0x5f,
+	0xa8, 0x45, 0xcc, 0xd0, 0x38, 0xbb, 0x37, 0x4f, 0xaf, 0x62, 0xe1, 0x33, 0xbd, 0x39, 0xae, 0x59,
+	0x2d, 0xac, 0x29, 0x57, 0xad, 0x36, 0xc3, 0xd0, 0x2e, 0xab, 0x34, 0xcc, 0x57, 0xb8, 0xfb, 0x34,
+	0x49, 0xc7, 0xd2, 0x3c, 0xda, 0xae, 0x5d, 0xbf, 0xfc, 0x54, 0x33, 0x46, 0xcd, 0xcd, 0xde, 0xf1,
+	0x49, 0xb4, 0x2f, 0xca, 0xb7, 0x5a, 0x33, 0x60, 0xb0, 0x2a, 0xd1, 0xb9, 0xfb, 0x3b, 0x53, 0xcd,
+	0xb0, 0x3e, 0xb3, 0x49, 0xc9, 0x26, 0xce, 0x4b, 0xb9, 0x58, 0x40, 0xb5, 0x37, 0xc7, 0x5e, 0xb2,
+	0x3b, 0x4d, 0x47, 0xbb, 0xc9, 0xe4, 0xc5, 0x56, 0x32, 0x55, 0xaf, 0xeb, 0x41, 0xbe, 0x42, 0x42,
+	0x55, 0x4e, 0xb0, 0xc4, 0xf8, 0x39, 0xca, 0xc4, 0x55, 0x49, 0x4b, 0xd7, 0x3e, 0xf6, 0xb6, 0xc0,
+	0x39, 0x51, 0x62, 0xd8, 0xbe, 0x3e, 0xb6, 0x2c, 0xce, 0xca, 0x57, 0xba, 0x6e, 0xd8, 0x40, 0x33,
+	0xb5, 0x6e, 0x60, 0x4a, 0xbb, 0xcb, 0x2c, 0xb5, 0x42, 0xd1, 0xbd, 0xe0, 0x41, 0x3a, 0xaf, 0x2e,
+	0xcb, 0xbb, 0x38, 0x67, 0xb0, 0x7b, 0x33, 0xde, 0x58, 0x51, 0xd7, 0xaf, 0x2b, 0xd1, 0x6d, 0x56,
+	0xbb, 0xcb, 0xdb, 0x4c, 0xcd, 0x2e, 0xc6, 0xb1, 0x2c, 0xcd, 0xcb, 0x4b, 0xc6, 0x39, 0xce, 0xb0,
+	0x2e, 0xaf, 0x30, 0xae, 0x43, 0x6e, 0x3a, 0x5d, 0xb1, 0x36, 0xf6, 0xb4, 0xe6, 0x2e, 0xac, 0x3d,
+	0x53, 0x47, 0xc7, 0xb6, 0x32, 0x53, 0xf6, 0x73, 0xcb, 0xb8, 0x2e, 0xd9, 0xb1, 0xe5, 0x74, 0x32,
+	0xda, 0xb7, 0x3c, 0xcc, 0x3f, 0x47, 0xc4, 0xbf, 0xed, 0x4d, 0x5b, 0xe1, 0x5d, 0xdd, 0xc7, 0x36,
+	0xc0, 0xc4, 0x5f, 0x35, 0xb1, 0x59, 0x35, 0xdd, 0x64, 0x55, 0xae, 0x39, 0xbd, 0x32, 0x5d, 0xaf,
+	0x61, 0xcf, 0x47, 0x54, 0xcc, 0x36, 0xbe, 0x5d, 0x48, 0xbe, 0x49, 0xd1, 0x58, 0x67, 0xec, 0xcc,
+	0xc2, 0x6b, 0x62, 0x70, 0x3b, 0xb6, 0x36, 0x57, 0xc3, 0xcd, 0x42, 0xc8, 0x44, 0xb7, 0x3d, 0xf1,
+	0xe9, 0xc6, 0xdc, 0x3f, 0x60, 0xd3, 0x3c, 0xc5, 0xc1, 0x64, 0x36, 0xb4, 0x3f, 0xba, 0x3a, 0x57,
+	0xc7, 0xc7, 0x3f, 0xc1, 0x57, 0x46, 0x67, 0xd1, 0x5d, 0x71, 0xcb, 0xcf, 0x4b, 0x41, 0xe4, 0xd8,
+	0xce, 0x3f, 0x68, 0xce, 0x6e, 0x4d, 0xbe, 0xc5, 0x45, 0xd2, 0xe0, 0xfa, 0xe4, 0x40, 0xce, 0x3d,
+	0xb7, 0x3f, 0xdf, 0xc4, 0x3c, 0x5f, 0xbb, 0x50, 0x3f, 0x69, 0xca, 0x49, 0xb5, 0x3b, 0xe1, 0xde,
+	0xdd, 0x64, 0xd4, 0xf0, 0x51, 0x49, 0xb4, 0x4c, 0x3c, 0xc8, 0xcb, 0xcf, 0x33, 0x6a, 0xc2, 0x6a,
+	0xc2, 0x67, 0x41, 0xe3, 0xd8, 0xcc, 0x3b, 0xd6, 0x4c, 0xbf, 0x3d, 0xb5, 0x46, 0xec, 0x42, 0xdb,
+	0xd1, 0xc8, 0x4c, 0x4f, 0xbb, 0x4c, 0x5d, 0x4b, 0xe2, 0xbe, 0x39, 0xc8, 0xe4, 0x4f, 0xc7, 0xdc,
+	0x6c, 0x5e, 0x40, 0x5c, 0xc9, 0x5e, 0x5f, 0xbc, 0x3d, 0xbe, 0xdf, 0x39, 0xb9, 0x42, 0x58, 0x74,
+	0x5c, 0xc5, 0x5f, 0xc5, 0x77, 0x3a, 0xcc, 0x7a, 0x55, 0xe8, 0xfa, 0xc7, 0x4b, 0x54, 0xe1, 0xd5,
+	0xdf, 0x4d, 0xc6, 0x45, 0xc6, 0x6b, 0x48, 0xc1, 0x4c, 0xdd, 0xec, 0xf3, 0x59, 0x4a, 0xbc, 0xe9,
+	0x4b, 0xe6, 0x4e, 0xbf, 0x57, 0x47, 0xc0, 0xdb, 0x3f, 0xbf, 0x45, 0x4f, 0xc4, 0x4b, 0xcb, 0x5d,
+	0x47, 0xc9, 0xce, 0x4c, 0xec, 0xce, 0x4a, 0xef, 0xe6, 0xd5, 0x40, 0x63, 0xbf, 0x58, 0x54, 0xc2,
+	0x7c, 0x4e, 0xc9, 0x5d, 0x67, 0x49, 0x52, 0xbf, 0xed, 0x4c, 0xe0, 0xe7, 0x4f, 0xc9, 0x5f, 0x5c,
+	0x53, 0xca, 0x57, 0xcb, 0x45, 0xd8, 0x5a, 0xd9, 0xdd, 0x49, 0x6e, 0xcb, 0x53, 0xd1, 0x4f, 0x6c,
+	0xcb, 0xcd, 0x6e, 0x4e, 0x63, 0x4f, 0xd9, 0xf2, 0xc3, 0x3d, 0xbd, 0x4a, 0x71, 0x5d, 0xc0, 0x3e,
+	0xcd, 0x6d, 0x52, 0xf7, 0xbf, 0x5b, 0x6e, 0xdd, 0x3e, 0xc5, 0xf0, 0x48, 0xd9, 0xc8, 0x43, 0xcc,
+	0x45, 0xc9, 0x4d, 0xd8, 0x61, 0xca, 0x63, 0x58, 0xdd, 0x57, 0xcf, 0x48, 0xd5, 0xf2, 0x5c, 0x51,
+	0xe4, 0xcb, 0x4d, 0xc8, 0x58, 0xcc, 0x67, 0x65, 0x50, 0x52, 0xca, 0xdd, 0xde, 0x42, 0x72, 0xbf,
+	0x59, 0x58, 0xd8, 0x47, 0xcf, 0xe5, 0x6e, 0x4d, 0x78, 0xcb, 0xd8, 0x42, 0x64, 0xec, 0xc4, 0x4f,
+	0xee, 0xca, 0x50, 0x52, 0xce, 0x44, 0xd7, 0xce, 0x4a, 0x63, 0xcc, 0x5e, 0xc7, 0x3f, 0xc5, 0x4f,
+	0xcf, 0x52, 0xdc, 0x53, 0x69, 0xdb, 0xd3, 0x4e, 0x67, 0xde, 0x55, 0xdc, 0xda, 0x77, 0xf1, 0x56,
+	0x59, 0xff, 0xd6, 0x64, 0xd2, 0x57, 0xcd, 0x62, 0xef, 0xed, 0x5d, 0x6b, 0x68, 0x5b, 0xc5, 0x58,
+	0x51, 0xc2, 0x55, 0xf4, 0x5f, 0x57, 0xc1, 0x42, 0xdf, 0xc9, 0x41, 0xd3, 0x7a, 0x5c, 0xc8, 0x4d,
+	0x52, 0xcf, 0x4f, 0xc7, 0xe3, 0xf6, 0x42, 0xca, 0x54, 0xe2, 0x62, 0xfe, 0x62, 0xce, 0x4d, 0xc2,
+	0x41, 0xc1, 0x46, 0x6a, 0xc9, 0x5e, 0xdd, 0x5c, 0xe8, 0x4d, 0xcc, 0x64, 0xd0, 0x41, 0xf0, 0xcb,
+	0xdc, 0x4e, 0xda, 0x65, 0x63, 0xee, 0xe7, 0x4d, 0xdb, 0xd2, 0x4f, 0xdf, 0x5f, 0xec, 0xda, 0xec,
+	0xdf, 0x50, 0x5c, 0xe8, 0x5b, 0xe3, 0xd8, 0xf9, 0x56, 0x71, 0x6e, 0xee, 0xd9, 0x5e, 0xcc, 0x5a,
+	0x5f, 0xed, 0x56, 0xca, 0xfb, 0x56, 0xd7, 0x52, 0x73, 0xfd, 0x78, 0xd5, 0xf7, 0xee, 0x4d, 0xcb,
+	0x5c, 0x6c, 0xea, 0x70, 0x5f, 0xe2, 0xde, 0xf0, 0xe2, 0x4a, 0xcb, 0x6e, 0x6e, 0xdd, 0x47, 0xcd,
+	0xea, 0x49, 0xd3, 0xd9, 0x4c, 0xcf, 0xf4, 0x53, 0x5c, 0xf1, 0xce, 0x57, 0x6c, 0xea, 0xd3, 0x4c,
+	0x5f, 0xc6, 0x4e, 0xf1, 0xcf, 0x4c, 0x64, 0xc9, 0x4d, 0x7b, 0xcc, 0x4c, 0xcd, 0x4f, 0x79, 0x6f,
+	0xdb, 0xfc, 0x67, 0xed, 0x63, 0xd1, 0xee, 0x66, 0xf2, 0x4b, 0xe6, 0x76, 0x76, 0xca, 0x73, 0xfd,
+	0x5b, 0x57, 0xdd, 0x5a, 0xca, 0x4e, 0xfb, 0xce, 0x4c, 0xcd, 0x4f, 0xdb, 0x52, 0xcb, 0x54, 0x75,
+	0xdd, 0x74, 0x5c, 0x6c, 0xd7, 0x52, 0xca, 0x54, 0x68, 0xe9, 0x64, 0xe5, 0xe3, 0x6b, 0x72, 0x77,
+	0xe6, 0xde, 0x5c, 0xdd, 0x5f, 0x5c, 0xf6, 0xcf, 0x5b, 0x6f, 0xec, 0xdd, 0x57, 0x7d, 0xfe, 0x5c,
+	0xd5, 0x74, 0xfc, 0x77, 0xfb, 0xe3, 0x55, 0xcd, 0x4b, 0xce, 0x4f, 0xd1, 0x55, 0x68, 0xd8, 0xdf,
+	0xfe, 0xfa, 0xef, 0x4a, 0xde, 0x61, 0xd1, 0x5f, 0xdf, 0xf7, 0xe7, 0x5e, 0xe7, 0x5e, 0x59, 0xcd,
+	0x4d, 0x7e, 0xcf, 0x55, 0xdc, 0x52, 0xe9, 0xd7, 0x51, 0xd9, 0xdb, 0x4f, 0xd8, 0xf9, 0x6e, 0xec,
+	0x74, 0x51, 0xea, 0xde, 0xdb, 0x4f, 0xdd, 0x5a, 0xd0, 0x5c, 0xf3, 0xec, 0x57, 0xd5, 0xf4, 0xf6,
+	0x56, 0x78, 0x75, 0xd0, 0x5a, 0x78, 0xee, 0xea, 0x5d, 0xfc, 0xdc, 0xfd, 0x5a, 0x67, 0xce, 0x69,
+	0x6d, 0x6a, 0xd7, 0x58, 0x68, 0x6f, 0xe5, 0xe5, 0x66, 0xd7, 0x62, 0x6a, 0xe9, 0x77, 0xfd, 0x6f,
+	0xfb, 0x7b, 0xe0, 0x55, 0xd7, 0x5a, 0xd8, 0x51, 0xdd, 0x79, 0xe5, 0x5a, 0xf7, 0x6e, 0xdd, 0xfd,
+	0x58, 0xeb, 0xfc, 0xd2, 0x5a, 0xf0, 0x65, 0xdf, 0xed, 0x6e, 0x55, 0xdd, 0xf8, 0x5d, 0xd3, 0x5c,
+	0x7c, 0xe2, 0x7a, 0x73, 0xe0, 0x61, 0x6c, 0x65, 0xdc, 0x6b, 0xec, 0x6b, 0x61, 0xfb, 0xf0, 0x77,
+	0xd3, 0x66, 0x62, 0xdc, 0x75, 0x59, 0xd6, 0x5b, 0xd3, 0x51, 0xee, 0x7a, 0xd8, 0x7a, 0x69, 0x5e,
+	0xe6, 0xe7, 0x58, 0xd1, 0x75, 0xf4, 0x69, 0x75, 0xe2, 0x56, 0xfa, 0x6c, 0xf8, 0xd9, 0x56, 0xd8,
+	0x63, 0xdd, 0x71, 0x76, 0xee, 0x54, 0xea, 0xf3, 0xf8, 0xe9, 0xeb, 0x6f, 0xec, 0x6a, 0x64, 0xef,
+	0xe9, 0xf7, 0x5f, 0x7d, 0xe9, 0x61, 0xd9, 0x52, 0xd9, 0x6e, 0x67, 0xe2, 0x74, 0xde, 0x76, 0x67,
+	0xe7, 0xfe, 0x58, 0xd9, 0xfe, 0xef, 0x6b, 0x63, 0x6d, 0xdf, 0x5f, 0xdd, 0x6d, 0xea, 0x5f, 0x79,
+	0xdb, 0x6a, 0x68, 0xee, 0x72, 0xec, 0x72, 0x6b, 0xd9, 0x75, 0x72, 0x5f, 0x76, 0xdd, 0xf5, 0x6e,
+	0x60, 0xde, 0x6d, 0x70, 0xec, 0x71, 0xed, 0xf4, 0xeb, 0x55, 0xe0, 0xe4, 0x69, 0x77, 0xe9, 0x57,
+	0xd8, 0x6f, 0x7b, 0x6a, 0xe8, 0x5f, 0xe3, 0x6a, 0xdb, 0x72, 0x67, 0xe9, 0x65, 0xf1, 0x66, 0xda,
+	0x76, 0x7f, 0x5b, 0xda, 0x58, 0xde, 0x78, 0x63, 0xe6, 0xe1, 0x6b, 0x69, 0xe0, 0x62, 0xdf, 0x60,
+	0x68, 0xd6, 0x56, 0xef, 0xdf, 0x5c, 0xe3, 0xe9, 0x6b, 0x6c, 0xe4, 0xf9, 0x6c, 0xfb, 0x69, 0xf7,
+	0xde, 0x7d, 0x55, 0xee, 0xfc, 0xdf, 0x5e, 0x7c, 0xde, 0x5e, 0xd9, 0x60, 0xe4, 0x78, 0x5e, 0xdf,
+	0x67, 0x6f, 0x70, 0xdd, 0x73, 0x6c, 0xe0, 0x5e, 0xed, 0x68, 0xec, 0xe0, 0x67, 0x68, 0xf8, 0xe6,
+	0x68, 0xde, 0x5a, 0xda, 0x6d, 0xef, 0x64, 0x6b, 0xf6, 0xe4, 0x5f, 0xf8, 0xdd, 0xf7, 0x7d, 0x7d,
+	0x6c, 0xea, 0x70, 0x74, 0x74, 0x67, 0xfa, 0xf2, 0xef, 0x6a, 0xda, 0x67, 0xf2, 0xf3, 0x5e, 0xde,
+	0xf9, 0x5e, 0x74, 0xde, 0xf8, 0x78, 0x68, 0xf0, 0x64, 0xf6, 0xf1, 0xeb, 0x5f, 0xdb, 0x5a, 0xd9,
+	0x5d, 0xe1, 0xff, 0xf5, 0x65, 0xef, 0x68, 0xe3, 0x5e, 0xdd, 0x6c, 0x63, 0xdb, 0x60, 0x6e, 0xf1,
+	0x6f, 0xee, 0xe7, 0xed, 0x6a, 0xef, 0x7d, 0x77, 0x6b, 0x75, 0x78, 0xe9, 0x6b, 0xe4, 0x68, 0xee,
+	0x7d, 0xf9, 0x66, 0xf8, 0xe8, 0x66, 0xe7, 0xed, 0x63, 0xe3, 0x6b, 0xec, 0x69, 0xef, 0x7a, 0x66,
+	0xec, 0xfb, 0x77, 0xf1, 0xef, 0x77, 0xfe, 0x60, 0xe4, 0x7a, 0xed, 0x5b, 0xf3, 0xde, 0x63, 0xec,
+	0x77, 0x72, 0xfc, 0xf7, 0xe9, 0x68, 0xef, 0x67, 0xea, 0x78, 0xf6, 0xf6, 0x5e, 0xdd, 0x6c, 0x6c,
+	0xf2, 0x6b, 0xf6, 0xe4, 0x77, 0xf5, 0x61, 0x7c, 0xef, 0xf8, 0xf1, 0x6a, 0xe9, 0x75, 0x6e, 0xe7,
+	0x61, 0xe7, 0x6b, 0x76, 0xea, 0xfc, 0xf9, 0x70, 0xe6, 0x76, 0x64, 0x76, 0xdd, 0x66, 0x6e, 0xfb,
+	0xe7, 0x67, 0xf3, 0xee, 0x6d, 0xee, 0xee, 0x76, 0x75, 0x7f, 0x6e, 0xed, 0xfe, 0x7b, 0x79, 0xf0,
+	0x67, 0xe8, 0xef, 0x5e, 0xf2, 0xe2, 0x5e, 0xe2, 0x71, 0x68, 0xe7, 0x65, 0xdf, 0x68, 0xe5, 0x7d,
+	0x62, 0xf0, 0x71, 0xe6, 0x65, 0x7e, 0xfd, 0xe2, 0x66, 0xfb, 0xf8, 0xf9, 0x77, 0xe8, 0x66, 0xf8,
+	0xed, 0x66, 0x7b, 0xe5, 0x69, 0xe8, 0x7b, 0x6b, 0x7d, 0x72, 0xe2, 0x6c, 0x7a, 0x76, 0xfc, 0xe6,
+	0x63, 0xec, 0xfb, 0x79, 0x7e, 0x79, 0x74, 0xe7, 0xfb, 0x6f, 0x6f, 0xe6, 0x65, 0x7d, 0xeb, 0xf4,
+	0x72, 0x6b, 0xe1, 0x62, 0xf5, 0xe7, 0x75, 0x7d, 0x66, 0xe4, 0x6c, 0x6d, 0xe4, 0xf8, 0x61, 0xed,
+	0xec, 0x69, 0x7e, 0xeb, 0x6f, 0xea, 0x78, 0xff, 0x78, 0x6b, 0xeb, 0x7a, 0x7a, 0xfb, 0x72, 0x7a,
+	0xe6, 0x6a, 0x72, 0xe2, 0x6c, 0xf7, 0x6f, 0x76, 0xf6, 0xeb, 0x6a, 0xe8, 0x69, 0xe9, 0x66, 0xf3,
+	0x70, 0xfe, 0xef, 0x78, 0xf7, 0x70, 0xfb, 0xfe, 0xea, 0x65, 0xf0, 0xed, 0x72, 0x71, 0xe6, 0x63,
+	0xfe, 0x7a, 0xee, 0xee, 0x6a, 0xff, 0xec, 0x67, 0x7c, 0xe9, 0x6b, 0xee, 0x6f, 0xed, 0xf4, 0x6f,
+	0x77, 0xf0, 0xfc, 0x69, 0xf7, 0xf9, 0xf9, 0x75, 0xef, 0x6f, 0xe9, 0x6b, 0x79, 0x79, 0xfd, 0xfb,
+	0xe9, 0x6d, 0xfe, 0xec, 0xff, 0x77, 0x6c, 0xfb, 0xf8, 0x75, 0xfb, 0x79, 0xfe, 0xed, 0x79, 0x79,
+	0xfe, 0xf9, 0xfc, 0x6a, 0xe7, 0x70, 0x7a, 0xeb, 0x77, 0x6f, 0x72, 0xef, 0xff, 0x7c, 0x74, 0xee,
+	0x72, 0xed, 0x76, 0x76, 0xed, 0x70, 0x71, 0xf7, 0x76, 0xf0, 0xee, 0xfe, 0x74, 0x6e, 0xfc, 0x7e,
+	0xf9, 0xf5, 0x6c, 0xee, 0x7d, 0xf6, 0xf9, 0x6f, 0xf7, 0x73, 0xf8, 0xf8, 0x6c, 0xef, 0x7f, 0x73,
+	0xfd, 0xed, 0x6f, 0x79, 0xfc, 0xf6, 0x7b, 0x7d, 0x7e, 0x7b, 0xf5, 0xfc, 0x6e, 0xee, 0x75, 0xeb,
+	0x7e, 0x69, 0xed, 0x73, 0x77, 0xea, 0xfe, 0x7b, 0x7a, 0xf3, 0x70, 0xfb, 0x7e, 0xf8, 0xff, 0x6e,
+	0x7c, 0xf3, 0xfd, 0x77, 0xef, 0x7f, 0x79, 0x7a, 0xfa, 0x6f, 0xed, 0x6c, 0xea, 0x76, 0x73, 0x7c,
+	0xf1, 0x7a, 0xf7, 0x6d, 0xea, 0x70, 0xff, 0xf5, 0x7b, 0x7a, 0x7a, 0xf9, 0x71, 0xf8, 0xee, 0x6c,
+	0x7e, 0xeb, 0x70, 0xfa, 0xfd, 0xfb, 0x72, 0xf1, 0x6b, 0xea, 0x6f, 0xf5, 0x75, 0xf1, 0x73, 0xf8,
+	0x76, 0xef, 0x7d, 0x6e, 0xef, 0xf9, 0x6c, 0x7e, 0xec, 0xfe, 0x6a, 0xed, 0xfa, 0x6d, 0xef, 0x70,
+	0xf0, 0x77, 0x7e, 0x75, 0xef, 0xfe, 0x73, 0x78, 0xfe, 0xfa, 0xec, 0x78, 0xfb, 0x7b, 0x6e, 0xf8,
+	0xef, 0x7c, 0xfb, 0x7a, 0x7c, 0xfd, 0xfb, 0x71, 0x74, 0xf7, 0x76, 0xf8, 0xf6, 0x76, 0x7e, 0x7b,
+	0xf8, 0xfb, 0xfd, 0xf5, 0x6b, 0xfa, 0x7a, 0xeb, 0x77, 0xfe, 0xfb, 0x6c, 0xeb, 0x6f, 0xf7, 0x79,
+	0xf6, 0x73, 0x7e, 0x7e, 0xf2, 0x78, 0x77, 0xfa, 0xf9, 0x7a, 0xf9, 0xf8, 0x7a, 0xfb, 0x72, 0xf0,
+	0xfd, 0x74, 0x72, 0xfd, 0xee, 0xfc, 0x7b, 0x79, 0xfe, 0x74, 0xf2, 0xf5, 0x6d, 0xf5, 0xf9, 0x7a,
+	0x77, 0x7c, 0xf2, 0xfa, 0x7e, 0x73, 0xf6, 0xfd, 0x74, 0xf5, 0x76, 0x7a, 0x7a, 0xee, 0xfe, 0x6e,
+	0xff, 0xf9, 0x7c, 0xf2, 0x72, 0xf5, 0x7e, 0x7a, 0xf3, 0x75, 0xfd, 0xfb, 0x79, 0x7a, 0xee, 0x7a,
+	0x7a, 0x7e, 0xfc, 0x77, 0x7a, 0xf4, 0xf7, 0x6e, 0xed, 0x71, 0xf0, 0x7a, 0x73, 0x7e, 0xef, 0xfd,
+	0x7b, 0x7a, 0x7e, 0xf9, 0xfe, 0xff, 0x73, 0xf3, 0xfc, 0x76, 0x72, 0xfb, 0xf5, 0x7a, 0xf4, 0x79,
+	0xfe, 0x73, 0xf7, 0xfb, 0xfa, 0x7f, 0x71, 0xfa, 0xf4, 0x6d, 0x7f, 0xfd, 0xf3, 0x76, 0xf7, 0xfc,
+	0x7f, 0x6f, 0xf1, 0xfd, 0x7d, 0xfc, 0x7e, 0x7b, 0xfa, 0x78, 0x76, 0xfb, 0xf1, 0x72, 0xfc, 0xf7,
+	0x7b, 0xfd, 0x78, 0xfe, 0x76, 0xfc, 0x7e, 0xf7, 0x7f, 0x76, 0xf3, 0x74, 0xf9, 0x78, 0xf6, 0x78,
+	0xef, 0x73, 0xf6, 0x77, 0x7d, 0xf5, 0x74, 0xfa, 0xfd, 0xf8, 0x79, 0x72, 0xf7, 0xf5, 0x7d, 0x75,
+	0x7a, 0xfc, 0xf5, 0x74, 0xf1, 0x73, 0xf7, 0xff, 0x76, 0xfa, 0xfd, 0x78, 0xfa, 0xfd, 0xf9, 0x72,
+	0x7d, 0xf9, 0xfd, 0x7d, 0xf7, 0x72, 0xf9, 0x7e, 0x7a, 0xfa, 0xff, 0x7e, 0xf8, 0xfb, 0x7f, 0x71,
+	0xfc, 0xf4, 0x6f, 0xff, 0x7f, 0xef, 0x77, 0x7e, 0x79, 0xf1, 0xfd, 0x7a, 0xfb, 0x79, 0x7a, 0x7d,
+	0xfd, 0x7c, 0xfb, 0x79, 0xff, 0xf0, 0x7e, 0x7e, 0x77, 0xfd, 0xfd, 0xfb, 0x77, 0xfb, 0xfe, 0xfa,
+	0x77, 0x79, 0xf8, 0xf7, 0x73, 0xf7, 0x77, 0xfd, 0xf9, 0x76, 0xf9, 0xfd, 0x7c, 0xf9, 0xfd, 0x76,
+	0xf7, 0xff, 0x7c, 0xff, 0x7f, 0xfc, 0x7e, 0x78, 0xf9, 0xfe, 0x7b, 0xf8, 0x76, 0xfb, 0xff, 0xfe,
+	0x78, 0xf7, 0x76, 0xf8, 0x7e, 0xfb, 0xfc, 0xfd, 0x73, 0xf4, 0x78, 0xfe, 0x78, 0xf2, 0x75, 0xfe,
+	0xff, 0x7e, 0xfe, 0xff, 0xfb, 0x7c, 0xf9, 0xfc, 0xff, 0x77, 0xfa, 0xfe, 0xff, 0x7a, 0x7c, 0xf6,
+	0x7d, 0x7a, 0xfa, 0x76, 0xf4, 0xfd, 0xfe, 0x72, 0xf6, 0xfe, 0x76, 0xf8, 0x79, 0xff, 0x7c, 0xfb,
+	0xf7, 0x7b, 0xfc, 0xfc, 0x73, 0xf5, 0xfe, 0x7b, 0x7a, 0x7d, 0xfb, 0x7e, 0x7d, 0xf9, 0x7e, 0x7a,
+	0x7e, 0xfa, 0xfc, 0x7e, 0x7f, 0xfb, 0x7d, 0x7b, 0xfb, 0x7e, 0x7b, 0x7d, 0xfc, 0xfa, 0xff, 0x79,
+	0xfc, 0x79, 0xf8, 0x7d, 0xfb, 0xfe, 0x74, 0xf3, 0x74, 0xf4, 0xff, 0x75, 0xfe, 0x7d, 0xf5, 0x7d,
+	0xfc, 0x7d, 0x79, 0xfa, 0x7a, 0x7f, 0xfe, 0xfb, 0x7a, 0xfc, 0xff, 0xfc, 0x7b, 0x7e, 0xfd, 0x7e,
+	0xfc, 0x77, 0xfe, 0x7d, 0xfa, 0xfa, 0x7c, 0xff, 0xfb, 0x7e, 0x78, 0x7e, 0xfb, 0x7b, 0xfa, 0x79,
+	0xfb, 0xfb, 0x79, 0x7e, 0xf8, 0x78, 0xf6, 0x7c, 0xfc, 0x7b, 0x7e, 0x7c, 0x7d, 0xf4, 0x76, 0x7d
+};
+
+static const SampleZone drums_zones[] = {
+	{ drums_zone0, 9600, 0, 0, 0, 0, SAMPLE_ADPCM, 35, 36, 36, 24000 },
+	{ drums_zone1, 7200, 0, 0, 0, 0, SAMPLE_ULAW, 37, 40, 38, 24000 },
+	{ drums_zone2, 2880, 0, 0, 0, 0, SAMPLE_ULAW, 42, 46, 42, 24000 },
+};
+
+// general midi kick, snare and hats from samples, pot 0 tunes them an octave down or up
+static const ModRoute drums_routes[] = {
+	{ MOD_SRC_POT(0), MOD_SRC_ONE, MOD_DST_PITCH, 24 },
+	{ MOD_SRC_ONE, MOD_SRC_ONE, MOD_DST_PITCH, -12 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_drums = {
+	.kind = INSTR_SAMPLE_NONE,
+	.adsrtimes = { 0.0005, 0, 1, 0.08 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.zones = drums_zones,
+	.numzones = 3,
+	.routes = drums_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0, 0, 0.15 } },
+};
+
+static const FmParams epiano_fm = {
+	4, 0,
+	{ { 1, 0.5, 0, -1 },
+	  { 1, 1.2, 1, 0 },
+	  { 1, 0.35, 0.8, -1 },
+	  { 14, 2, 0.15, 2 } }
+};
+
+// two fm pairs: a quickly decaying 14x tine over a softer 1x body
+static const ModRoute epiano_routes[] = {
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_epiano = {
+	.kind = INSTR_FM_NONE,
+	.adsrtimes = { 0.002, 1.5, 0.3, 0.3 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.spread = 0.4,
+	.fm = &epiano_fm,
+	.routes = epiano_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0.4, 0.15, 0.25 } },
+};
+
+static const FmParams fmbass_fm = {
+	2, 0.6,
+	{ { 1, 1, 0, -1 },
+	  { 1, 2.5, 0.25, 0 } }
+};
+
+// two operator stack with feedback on the modulator
+static const ModRoute fmbass_routes[] = {
+	{ MOD_SRC_BEND, MOD_SRC_ONE, MOD_DST_PITCH, 1 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_fmbass = {
+	.kind = INSTR_FM_NONE,
+	.adsrtimes = { 0.002, 0.4, 0.6, 0.08 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.fm = &fmbass_fm,
+	.routes = fmbass_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0, 0, 0.05 } },
+};
+
+// pink noise through a lowpass the global lfo sweeps slowly, pot 0 is the depth
+static const ModRoute wind_routes[] = {
+	{ MOD_SRC_GLFO, MOD_SRC_POT(0), MOD_DST_CUTOFF, 3 },
+	{ MOD_SRC_NONE }
+};
+
+CCM_DATA static Instrument patch_wind = {
+	.kind = INSTR_PINK_LP,
+	.adsrtimes = { 0.5, 0, 1, 1.5 },
+	.modenvtimes = { 0, 0, 0, 0 },
+	.cutoff = 400,
+	.spread = 0.6,
+	.routes = wind_routes,
+	.bus = { INSERT_NONE, 0, 0, 1, { 0, 0.1, 0.4 } },
+};
+
+CCM_DATA Instrument* instruments[] = {
+	&patch_bass,
+	&patch_noise,
+	&patch_pulsebass,
+	&patch_vibrato,
+	&patch_tejeez,
+	&patch_supersaw,
+	&patch_drums,
+	&patch_epiano,
+	&patch_fmbass,
+	&patch_wind,
+};
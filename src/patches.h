@@ -0,0 +1,20 @@
+// Generated from patches.json by gen_coefs.py, do not edit.
+
+#ifndef PATCHES_H
+#define PATCHES_H
+
+enum {
+	PATCH_BASS,
+	PATCH_NOISE,
+	PATCH_PULSEBASS,
+	PATCH_VIBRATO,
+	PATCH_TEJEEZ,
+	PATCH_SUPERSAW,
+	PATCH_DRUMS,
+	PATCH_EPIANO,
+	PATCH_FMBASS,
+	PATCH_WIND,
+	NUM_PATCHES
+};
+
+#endif
@@ -1 +0,0 @@
-float sawticks[128] = { 0.000340658288152, 0.000360914884084, 0.000382375999892, 0.000405113260055, 0.000429202548064, 0.000454724259678, 0.000481763571239, 0.000510410723935, 0.000540761324974, 0.000572916666667, 0.000606984064477, 0.000643077215177, 0.000681316576304, 0.000721829768169, 0.000764751999785, 0.00081022652011, 0.000858405096127, 0.000909448519357, 0.000963527142478, 0.00102082144787, 0.00108152264995, 0.00114583333333, 0.00121396812895, 0.00128615443035, 0.00136263315261, 0.00144365953634, 0.00152950399957, 0.00162045304022, 0.00171681019225, 0.00181889703871, 0.00192705428496, 0.00204164289574, 0.0021630452999, 0.00229166666667, 0.00242793625791, 0.00257230886071, 0.00272526630521, 0.00288731907268, 0.00305900799914, 0.00324090608044, 0.00343362038451, 0.00363779407743, 0.00385410856991, 0.00408328579148, 0.00432609059979, 0.00458333333333, 0.00485587251581, 0.00514461772142, 0.00545053261043, 0.00577463814535, 0.00611801599828, 0.00648181216088, 0.00686724076902, 0.00727558815485, 0.00770821713983, 0.00816657158295, 0.00865218119958, 0.00916666666667, 0.00971174503163, 0.0102892354428, 0.0109010652209, 0.0115492762907, 0.0122360319966, 0.0129636243218, 0.013734481538, 0.0145511763097, 0.0154164342797, 0.0163331431659, 0.0173043623992, 0.0183333333333, 0.0194234900633, 0.0205784708857, 0.0218021304417, 0.0230985525814, 0.0244720639931, 0.0259272486435, 0.0274689630761, 0.0291023526194, 0.0308328685593, 0.0326662863318, 0.0346087247983, 0.0366666666667, 0.0388469801265, 0.0411569417713, 0.0436042608834, 0.0461971051628, 0.0489441279862, 0.051854497287, 0.0549379261521, 0.0582047052388, 0.0616657371186, 0.0653325726636, 0.0692174495967, 0.0733333333333, 0.077693960253, 0.0823138835427, 0.0872085217669, 0.0923942103256, 0.0978882559725, 0.103708994574, 0.109875852304, 0.116409410478, 0.123331474237, 0.130665145327, 0.138434899193, 0.146666666667, 0.155387920506, 0.164627767085, 0.174417043534, 0.184788420651, 0.195776511945, 0.207417989148, 0.219751704609, 0.232818820955, 0.246662948474, 0.261330290654, 0.276869798387, 0.293333333333, 0.310775841012, 0.329255534171, 0.348834087067, 0.369576841302, 0.39155302389, 0.414835978296, 0.439503409217, 0.465637641911, 0.493325896949, 0.522660581309 };
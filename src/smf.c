@@ -0,0 +1,179 @@
+#include <stddef.h>
+#include "smf.h"
+#include "synth.h"
+
+// Same as CHAN_MAP in mididump/mididump-elli.py (which is 1-based):
+// bass, tejeez, vibrato, -, pulsebass; the gm drum channel plays the sampled kit
+static const int8_t defaultmap[16] = {
+	-1, PATCH_BASS, PATCH_TEJEEZ, PATCH_VIBRATO, -1, PATCH_PULSEBASS, -1, -1,
+	-1, PATCH_DRUMS, -1, -1, -1, -1, -1, -1
+};
+
+static uint32_t rd16(const uint8_t *p) {
+	return (p[0] << 8) | p[1];
+}
+
+static uint32_t rd32(const uint8_t *p) {
+	return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static uint32_t rdvar(struct smftrack *t) {
+	uint32_t v = 0;
+	for (int i = 0; i < 4 && t->pos < t->end; i++) {
+		uint8_t b = *t->pos++;
+		v = (v << 7) | (b & 0x7f);
+		if (!(b & 0x80))
+			return v;
+	}
+	t->done = 1;
+	return 0;
+}
+
+static void set_tempo(struct smfplayer *p, uint32_t usperquarter) {
+	p->tempo = usperquarter;
+	p->tickstep = ((uint64_t)usperquarter * p->samplerate << 16)
+		/ (1000000ull * p->division);
+}
+
+static void read_delta(struct smftrack *t) {
+	if (t->pos >= t->end) {
+		t->done = 1;
+		return;
+	}
+	t->tick += rdvar(t);
+}
+
+int smf_open(struct smfplayer *p, const uint8_t *data, uint32_t len, int samplerate) {
+	const uint8_t *end = data + len;
+
+	if (len < 14 || rd32(data) != 0x4d546864) // MThd
+		return -1;
+	uint32_t hdrlen = rd32(data + 4);
+	int format = rd16(data + 8);
+	p->division = rd16(data + 12);
+	if (hdrlen < 6 || format > 1 || p->division == 0 || (p->division & 0x8000))
+		return -1; // no format 2 and no smpte time
+
+	p->samplerate = samplerate;
+	p->ntracks = 0;
+	for (const uint8_t *c = data + 8 + hdrlen; c + 8 <= end; ) {
+		uint32_t sz = rd32(c + 4);
+		if (sz > (uint32_t)(end - c - 8))
+			sz = end - c - 8; // truncated file, play what's there
+		if (rd32(c) == 0x4d54726b && p->ntracks < SMF_MAX_TRACKS) { // MTrk
+			p->tracks[p->ntracks].start = c + 8;
+			p->tracks[p->ntracks].end = c + 8 + sz;
+			p->ntracks++;
+		}
+		c += 8 + sz;
+	}
+	if (!p->ntracks)
+		return -1;
+
+	for (int i = 0; i < 16; i++)
+		p->chanmap[i] = defaultmap[i];
+	smf_rewind(p);
+	return 0;
+}
+
+void smf_rewind(struct smfplayer *p) {
+	for (int i = 0; i < p->ntracks; i++) {
+		struct smftrack *t = &p->tracks[i];
+		t->pos = t->start;
+		t->tick = 0;
+		t->status = 0;
+		t->done = 0;
+		read_delta(t);
+	}
+	p->tick = 0;
+	p->ticktime = 0;
+	p->now = 0;
+	set_tempo(p, 500000); // 120 bpm until told otherwise
+}
+
+static void channel_event(struct smfplayer *p, int status, int a, int b) {
+	int instr = p->chanmap[status & 0xf];
+	if (instr < 0)
+		return;
+	int type = status & 0xf0;
+	if (type == 0x90 && b)
+		synth_note_on(a, instr, b / 127.0);
+	else if (type == 0x80 || type == 0x90) // velocity 0 is a note off too
+		synth_note_off(a, instr);
+}
+
+static void track_event(struct smfplayer *p, struct smftrack *t) {
+	uint8_t st = *t->pos;
+	if (st & 0x80) {
+		t->pos++;
+		// sysex and meta events cancel running status
+		t->status = st < 0xf0 ? st : 0;
+	} else if (t->status) {
+		st = t->status;
+	} else {
+		t->done = 1; // data byte without status, broken track
+		return;
+	}
+
+	if (st == 0xff) {
+		if (t->pos >= t->end) {
+			t->done = 1;
+			return;
+		}
+		uint8_t type = *t->pos++;
+		uint32_t len = rdvar(t);
+		if (len > (uint32_t)(t->end - t->pos)) {
+			t->done = 1;
+			return;
+		}
+		if (type == 0x51 && len == 3)
+			set_tempo(p, (t->pos[0] << 16) | (t->pos[1] << 8) | t->pos[2]);
+		else if (type == 0x2f)
+			t->done = 1;
+		t->pos += len;
+	} else if (st == 0xf0 || st == 0xf7) {
+		uint32_t len = rdvar(t);
+		if (len > (uint32_t)(t->end - t->pos))
+			len = t->end - t->pos;
+		t->pos += len;
+	} else {
+		int n = (st & 0xe0) == 0xc0 ? 1 : 2; // program change, aftertouch
+		if (t->end - t->pos < n) {
+			t->done = 1;
+			return;
+		}
+		int a = t->pos[0], b = n == 2 ? t->pos[1] : 0;
+		t->pos += n;
+		channel_event(p, st, a, b);
+	}
+	if (!t->done)
+		read_delta(t);
+}
+
+/*
+ * Play the events that fall in the next nsamples from the current position.
+ * Tracks are merged by always taking the cursor with the earliest tick.
+ * Returns 0 when all tracks have ended.
+ */
+int smf_play(struct smfplayer *p, int nsamples) {
+	uint64_t until = p->now + ((uint64_t)nsamples << 16);
+	for (;;) {
+		struct smftrack *next = NULL;
+		for (int i = 0; i < p->ntracks; i++) {
+			struct smftrack *t = &p->tracks[i];
+			if (!t->done && (!next || t->tick < next->tick))
+				next = t;
+		}
+		if (!next)
+			return 0;
+
+		uint64_t evtime = p->ticktime + (uint64_t)(next->tick - p->tick) * p->tickstep;
+		if (evtime >= until)
+			break;
+		p->ticktime = evtime;
+		p->tick = next->tick;
+		track_event(p, next);
+	}
+	p->now = until;
+	return 1;
+}
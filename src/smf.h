@@ -0,0 +1,36 @@
+#ifndef SMF_H
+#define SMF_H
+
+#include <stdint.h>
+
+// Standard MIDI File (format 0/1) player that reads the file image in place,
+// e.g. from flash. Only a cursor per track is kept in RAM.
+
+#define SMF_MAX_TRACKS 16
+
+struct smftrack {
+	const uint8_t *start, *end;
+	const uint8_t *pos;
+	uint32_t tick; // absolute tick of the next event
+	uint8_t status; // running status
+	uint8_t done;
+};
+
+struct smfplayer {
+	int ntracks;
+	int division; // ticks per quarter note
+	int samplerate;
+	struct smftrack tracks[SMF_MAX_TRACKS];
+	uint32_t tick; // tick of the latest event played
+	uint64_t ticktime; // sample time of that tick, 16.16 fixed point
+	uint64_t now; // song position in samples, 16.16 fixed point
+	uint32_t tickstep; // samples per tick, 16.16 fixed point
+	uint32_t tempo; // microseconds per quarter note
+	int8_t chanmap[16]; // midi channel -> instrument, -1 to mute
+};
+
+int smf_open(struct smfplayer *p, const uint8_t *data, uint32_t len, int samplerate);
+void smf_rewind(struct smfplayer *p);
+int smf_play(struct smfplayer *p, int nsamples);
+
+#endif
@@ -0,0 +1,2161 @@
+#include <stdint.h>
+
+const uint8_t song_mid[] = {
+	0x4d, 0x54, 0x68, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x4d, 0x54,
+	0x72, 0x6b, 0x00, 0x00, 0x86, 0xa0, 0x00, 0xff, 0x01, 0x26, 0x69, 0x73, 0x69, 0x6d, 0x69, 0x64,
+	0x69, 0x2e, 0x70, 0x6c, 0x20, 0x61, 0x74, 0x20, 0x54, 0x68, 0x75, 0x20, 0x4d, 0x61, 0x72, 0x20,
+	0x32, 0x35, 0x20, 0x32, 0x32, 0x3a, 0x34, 0x31, 0x3a, 0x34, 0x32, 0x20, 0x32, 0x30, 0x30, 0x34,
+	0x00, 0xc1, 0x51, 0x00, 0xc2, 0x51, 0x00, 0xc3, 0x51, 0x00, 0xc4, 0x43, 0x00, 0xc5, 0x3b, 0x00,
+	0xc6, 0x3b, 0x00, 0xc7, 0x50, 0x00, 0xff, 0x51, 0x03, 0x01, 0x0b, 0x94, 0x60, 0x91, 0x3c, 0x7f,
+	0x00, 0x92, 0x3c, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x3c, 0x0a,
+	0x00, 0x96, 0x3c, 0x0a, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f,
+	0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a,
+	0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x30, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x85, 0x30, 0x00, 0x00, 0x86, 0x3c, 0x00,
+	0x60, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f,
+	0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42,
+	0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x3c, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x3c, 0x0a,
+	0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f,
+	0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f,
+	0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a,
+	0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x3c, 0x7f,
+	0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00,
+	0x00, 0x85, 0x30, 0x00, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f,
+	0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x60, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f,
+	0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x30, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x85, 0x30, 0x00, 0x00, 0x86, 0x3c, 0x00,
+	0x60, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f,
+	0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42,
+	0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x3c, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x3c, 0x0a,
+	0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f,
+	0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f,
+	0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a,
+	0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x3c, 0x7f,
+	0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00,
+	0x00, 0x85, 0x30, 0x00, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x3f, 0x7f,
+	0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x3f, 0x0a,
+	0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x1b, 0x42,
+	0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a,
+	0x60, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00,
+	0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x82, 0x3f, 0x00,
+	0x00, 0x85, 0x3f, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b, 0x7f,
+	0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b, 0x0a,
+	0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f,
+	0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00,
+	0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3f, 0x0a,
+	0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x33, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f,
+	0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x33, 0x0a,
+	0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42,
+	0x60, 0x81, 0x33, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f,
+	0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x33, 0x00, 0x00, 0x95, 0x3f, 0x0a,
+	0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f,
+	0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00,
+	0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f,
+	0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a,
+	0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x82, 0x3f, 0x00,
+	0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x86, 0x3f, 0x00,
+	0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f,
+	0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42,
+	0x60, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00,
+	0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f,
+	0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f,
+	0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a,
+	0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x33, 0x7f,
+	0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00,
+	0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x33, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a,
+	0x60, 0x81, 0x33, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f, 0x00, 0x85, 0x33, 0x00, 0x00, 0x95, 0x3e, 0x0a,
+	0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1a, 0x42,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f,
+	0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a,
+	0x60, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00,
+	0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x82, 0x3e, 0x00,
+	0x00, 0x85, 0x32, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x92, 0x4a, 0x7f,
+	0x00, 0x93, 0x32, 0x7f, 0x00, 0x94, 0x26, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x96, 0x4a, 0x0a,
+	0x00, 0x87, 0x1a, 0x00, 0x00, 0x97, 0x26, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x3e, 0x7f,
+	0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x32, 0x00, 0x00, 0x84, 0x26, 0x00,
+	0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96, 0x3e, 0x0a,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f,
+	0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a,
+	0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x00, 0x87, 0x26, 0x00, 0x00, 0x97, 0x1a, 0x42,
+	0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x3e, 0x0a,
+	0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f,
+	0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a,
+	0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a,
+	0x60, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00,
+	0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x82, 0x3e, 0x00,
+	0x00, 0x85, 0x32, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x92, 0x4a, 0x7f,
+	0x00, 0x93, 0x32, 0x7f, 0x00, 0x94, 0x26, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x96, 0x4a, 0x0a,
+	0x00, 0x87, 0x1a, 0x00, 0x00, 0x97, 0x26, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x3e, 0x7f,
+	0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x32, 0x00, 0x00, 0x84, 0x26, 0x00,
+	0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96, 0x3e, 0x0a,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f,
+	0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a,
+	0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x00, 0x87, 0x26, 0x00, 0x00, 0x97, 0x1a, 0x42,
+	0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x3e, 0x0a,
+	0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41, 0x7f,
+	0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f,
+	0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x41, 0x0a,
+	0x00, 0x87, 0x1a, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f,
+	0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a,
+	0x60, 0x82, 0x35, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f,
+	0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d, 0x42,
+	0x60, 0x81, 0x41, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00,
+	0x00, 0x85, 0x41, 0x00, 0x00, 0x86, 0x41, 0x00, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x92, 0x4d, 0x7f,
+	0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x96, 0x4d, 0x0a,
+	0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x82, 0x4d, 0x00, 0x00, 0x92, 0x41, 0x7f,
+	0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x86, 0x4d, 0x00, 0x00, 0x96, 0x41, 0x0a,
+	0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f,
+	0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x41, 0x0a,
+	0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d, 0x42,
+	0x60, 0x82, 0x35, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00,
+	0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x46, 0x7f,
+	0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f,
+	0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x46, 0x0a,
+	0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f,
+	0x00, 0x82, 0x46, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x46, 0x00,
+	0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x41, 0x7f,
+	0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00,
+	0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d, 0x42,
+	0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x83, 0x29, 0x00,
+	0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00,
+	0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x2e, 0x7f,
+	0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46, 0x0a,
+	0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3f, 0x7f,
+	0x00, 0x82, 0x46, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3f, 0x0a, 0x00, 0x86, 0x46, 0x00,
+	0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x2e, 0x00,
+	0x00, 0x84, 0x22, 0x00, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x3e, 0x0a,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x85, 0x3e, 0x00,
+	0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x3c, 0x7f,
+	0x00, 0x92, 0x3c, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x85, 0x32, 0x00,
+	0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x24, 0x42,
+	0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f,
+	0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a,
+	0x60, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00,
+	0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x30, 0x00, 0x00, 0x82, 0x3c, 0x00,
+	0x00, 0x85, 0x30, 0x00, 0x00, 0x86, 0x3c, 0x00, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48, 0x7f,
+	0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a,
+	0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x3c, 0x7f,
+	0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00,
+	0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f,
+	0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a,
+	0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42,
+	0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x3c, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x30, 0x00, 0x00, 0x95, 0x3c, 0x0a,
+	0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f,
+	0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a,
+	0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f,
+	0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x30, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x85, 0x30, 0x00, 0x00, 0x86, 0x3c, 0x00,
+	0x60, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f,
+	0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42,
+	0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x3c, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3c, 0x7f,
+	0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x3c, 0x0a,
+	0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x30, 0x7f,
+	0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f,
+	0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a,
+	0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x3c, 0x7f,
+	0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00,
+	0x00, 0x85, 0x30, 0x00, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3c, 0x0a,
+	0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x3f, 0x7f,
+	0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x3f, 0x0a,
+	0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x27, 0x42,
+	0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a,
+	0x60, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00,
+	0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x82, 0x3f, 0x00,
+	0x00, 0x85, 0x3f, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b, 0x7f,
+	0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b, 0x0a,
+	0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f,
+	0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00,
+	0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3f, 0x0a,
+	0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x33, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f,
+	0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x33, 0x0a,
+	0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42,
+	0x60, 0x81, 0x33, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f,
+	0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85, 0x33, 0x00, 0x00, 0x95, 0x3f, 0x0a,
+	0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f,
+	0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f,
+	0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f,
+	0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a,
+	0x60, 0x81, 0x3f, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x86, 0x3f, 0x00,
+	0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f,
+	0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42,
+	0x60, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00,
+	0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f,
+	0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f,
+	0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a,
+	0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x33, 0x7f,
+	0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00,
+	0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x33, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x3f, 0x0a,
+	0x60, 0x81, 0x33, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x93, 0x32, 0x7f, 0x00, 0x94, 0x26, 0x7f, 0x00, 0x85, 0x33, 0x00, 0x00, 0x95, 0x3e, 0x0a,
+	0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x26, 0x42,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f,
+	0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a,
+	0x60, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x32, 0x00, 0x00, 0x84, 0x26, 0x00,
+	0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x82, 0x3e, 0x00,
+	0x00, 0x85, 0x32, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x92, 0x4a, 0x7f,
+	0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x96, 0x4a, 0x0a,
+	0x00, 0x87, 0x26, 0x00, 0x00, 0x97, 0x1a, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x3e, 0x7f,
+	0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00,
+	0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96, 0x3e, 0x0a,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f,
+	0x00, 0x93, 0x32, 0x7f, 0x00, 0x94, 0x26, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a,
+	0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x00, 0x87, 0x1a, 0x00, 0x00, 0x97, 0x26, 0x42,
+	0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x83, 0x32, 0x00, 0x00, 0x84, 0x26, 0x00, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x3e, 0x0a,
+	0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f,
+	0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a,
+	0x00, 0x87, 0x26, 0x00, 0x00, 0x97, 0x1a, 0x42, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f,
+	0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a,
+	0x60, 0x81, 0x32, 0x00, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x85, 0x32, 0x00, 0x00, 0x86, 0x3e, 0x00,
+	0x60, 0x91, 0x4a, 0x7f, 0x00, 0x92, 0x4a, 0x7f, 0x00, 0x93, 0x32, 0x7f, 0x00, 0x94, 0x26, 0x7f,
+	0x00, 0x95, 0x4a, 0x0a, 0x00, 0x96, 0x4a, 0x0a, 0x00, 0x87, 0x1a, 0x00, 0x00, 0x97, 0x26, 0x42,
+	0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x3e, 0x7f,
+	0x00, 0x83, 0x32, 0x00, 0x00, 0x84, 0x26, 0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a,
+	0x00, 0x86, 0x4a, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x32, 0x7f,
+	0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x93, 0x26, 0x7f, 0x00, 0x94, 0x1a, 0x7f,
+	0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a,
+	0x00, 0x87, 0x26, 0x00, 0x00, 0x97, 0x1a, 0x42, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x3e, 0x7f,
+	0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x26, 0x00, 0x00, 0x84, 0x1a, 0x00,
+	0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x3e, 0x0a,
+	0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f,
+	0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x41, 0x0a,
+	0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1a, 0x00, 0x00, 0x97, 0x29, 0x42,
+	0x60, 0x81, 0x41, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x86, 0x41, 0x00,
+	0x60, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x84, 0x44, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48,
+	0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x24, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x47,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x95, 0x47, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x60, 0x81, 0x47, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x92, 0x47, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x85, 0x47,
+	0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x47, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18,
+	0x42, 0x60, 0x82, 0x47, 0x00, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x86, 0x47,
+	0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x47, 0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x37,
+	0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x47, 0x0a, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x86, 0x48, 0x00, 0x60, 0x81, 0x47, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x47,
+	0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x48,
+	0x00, 0x60, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92, 0x30,
+	0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x43,
+	0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18,
+	0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92, 0x30,
+	0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x43,
+	0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18,
+	0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x3f,
+	0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a,
+	0x0a, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32,
+	0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29,
+	0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d,
+	0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x52,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91, 0x3a,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x52,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91, 0x3a,
+	0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x3e,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4a,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32,
+	0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x35,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32,
+	0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x46,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29,
+	0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d,
+	0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3a,
+	0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4d,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x32,
+	0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x18,
+	0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82, 0x30,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3f,
+	0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x37,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24,
+	0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82, 0x30,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x43,
+	0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18,
+	0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x37,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18,
+	0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x48,
+	0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x37, 0x0a, 0x60, 0x91, 0x4f, 0x7f, 0x00, 0x82, 0x37,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x4f, 0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96, 0x3f,
+	0x0a, 0x60, 0x81, 0x4f, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x4f, 0x00, 0x00, 0x95, 0x37,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b,
+	0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x30,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x37,
+	0x0a, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x37, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x30, 0x00, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f,
+	0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x82, 0x30, 0x00, 0x00, 0x92, 0x48,
+	0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92, 0x30,
+	0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x43,
+	0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18,
+	0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92, 0x30,
+	0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x43,
+	0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18,
+	0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x3f,
+	0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a,
+	0x0a, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32,
+	0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29,
+	0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d,
+	0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x52,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91, 0x3a,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x52,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91, 0x3a,
+	0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x3e,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4a,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32,
+	0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x35,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32,
+	0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x46,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x29,
+	0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29,
+	0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d,
+	0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3a,
+	0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4d,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x3e,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x32,
+	0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x18,
+	0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82, 0x30,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3f,
+	0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x37,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24,
+	0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x43,
+	0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82, 0x30,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x43,
+	0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18,
+	0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x37,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18,
+	0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x48,
+	0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x37, 0x0a, 0x60, 0x91, 0x4f, 0x7f, 0x00, 0x82, 0x37,
+	0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x4f, 0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96, 0x3f,
+	0x0a, 0x60, 0x81, 0x4f, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x4f, 0x00, 0x00, 0x95, 0x37,
+	0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b,
+	0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x30,
+	0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x37,
+	0x0a, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x37, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x30, 0x00, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f,
+	0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x4b,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x33,
+	0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4e, 0x7f, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95, 0x4e,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x33,
+	0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x4e,
+	0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x4e, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x42,
+	0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4e,
+	0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49,
+	0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c,
+	0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20,
+	0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94, 0x2c,
+	0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x3d,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x50,
+	0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x50, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x50, 0x00, 0x00, 0x95, 0x44,
+	0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94, 0x2c,
+	0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x3d,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49,
+	0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35,
+	0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x38,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x38, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x81, 0x38, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x38, 0x00, 0x00, 0x95, 0x49,
+	0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c,
+	0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20,
+	0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49,
+	0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x3d,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d,
+	0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50,
+	0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x50,
+	0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x60, 0x81, 0x50, 0x00, 0x00, 0x82, 0x49,
+	0x00, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x85, 0x50, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x38,
+	0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x38, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x38, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49,
+	0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x1b,
+	0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x33,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42,
+	0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3a,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27,
+	0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x33,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3a,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x4b,
+	0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x3a,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3a, 0x00, 0x00, 0x96, 0x42,
+	0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x4a,
+	0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e,
+	0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x4a,
+	0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x39, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96, 0x39,
+	0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x39, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x4a,
+	0x0a, 0x00, 0x86, 0x39, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22,
+	0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x4b,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x33,
+	0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4e, 0x7f, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95, 0x4e,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x33,
+	0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x4e,
+	0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x4e, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x42,
+	0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x82, 0x42,
+	0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4e,
+	0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49,
+	0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c,
+	0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20,
+	0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94, 0x2c,
+	0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x3d,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x50,
+	0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x50, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x50, 0x00, 0x00, 0x95, 0x44,
+	0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94, 0x2c,
+	0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x3d,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49,
+	0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x4d,
+	0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35,
+	0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44,
+	0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x38,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x38, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35,
+	0x0a, 0x60, 0x81, 0x38, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49,
+	0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x38, 0x00, 0x00, 0x95, 0x49,
+	0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20,
+	0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44,
+	0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c,
+	0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20,
+	0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49,
+	0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x3d,
+	0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d,
+	0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50,
+	0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x50,
+	0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x60, 0x81, 0x50, 0x00, 0x00, 0x82, 0x49,
+	0x00, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x85, 0x50, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x38,
+	0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x38, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x38, 0x00, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35,
+	0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49,
+	0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x4b,
+	0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x1b,
+	0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x33,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42,
+	0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3a,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27,
+	0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x33,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95, 0x46,
+	0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x3a,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b,
+	0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x4b,
+	0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x85, 0x4b,
+	0x00, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x3a,
+	0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3a, 0x00, 0x00, 0x96, 0x42,
+	0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f,
+	0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91, 0x4a,
+	0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e,
+	0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x4a,
+	0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x39, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96, 0x39,
+	0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x39, 0x00, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x4a,
+	0x0a, 0x00, 0x86, 0x39, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22,
+	0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b,
+	0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x86, 0x43,
+	0x00, 0x60, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x37, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x2b,
+	0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x43,
+	0x0a, 0x60, 0x82, 0x43, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x43,
+	0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x93, 0x37,
+	0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x37,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x86, 0x37,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x43,
+	0x00, 0x60, 0x92, 0x37, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x37,
+	0x0a, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x37,
+	0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x86, 0x43,
+	0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x3e,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x37, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x37,
+	0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x41,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x86, 0x41,
+	0x00, 0x60, 0x81, 0x45, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x45,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x35, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x35, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x35,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x3e,
+	0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3e,
+	0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x45, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x45,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x45, 0x00, 0x00, 0x86, 0x45,
+	0x00, 0x60, 0x81, 0x45, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x45,
+	0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x60, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x37,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x82, 0x43, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x43, 0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x3e,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x37, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x86, 0x37, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x2b,
+	0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22,
+	0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3c, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3c,
+	0x00, 0x60, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x48,
+	0x0a, 0x60, 0x82, 0x48, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x48,
+	0x00, 0x60, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e,
+	0x7f, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x81, 0x45, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x85, 0x45, 0x00, 0x00, 0x86, 0x3c,
+	0x00, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x41, 0x00, 0x00, 0x82, 0x46,
+	0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x3a,
+	0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x84, 0x29, 0x00, 0x00, 0x94, 0x1d,
+	0x7f, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d,
+	0x42, 0x60, 0x81, 0x45, 0x00, 0x00, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d,
+	0x00, 0x00, 0x85, 0x45, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x41,
+	0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d,
+	0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x86, 0x41, 0x00, 0x60, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x35,
+	0x7f, 0x00, 0x93, 0x39, 0x7f, 0x00, 0x94, 0x2d, 0x7f, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x35,
+	0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x2d, 0x42, 0x60, 0x81, 0x45, 0x00, 0x00, 0x82, 0x35,
+	0x00, 0x00, 0x85, 0x45, 0x00, 0x00, 0x86, 0x35, 0x00, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x43,
+	0x7f, 0x00, 0x83, 0x39, 0x00, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x84, 0x2d, 0x00, 0x00, 0x94, 0x2b,
+	0x7f, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x2d, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x60, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x37,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x82, 0x43, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x43, 0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x3e,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x37, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x86, 0x37, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x43, 0x00, 0x60, 0x92, 0x37, 0x7f, 0x00, 0x93, 0x2b,
+	0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x37, 0x0a, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x37,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2b,
+	0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x3e,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x45,
+	0x7f, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x43,
+	0x00, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x86, 0x41, 0x00, 0x60, 0x81, 0x45, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x45, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x35,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x35, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x35, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x3e,
+	0x7f, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x3e, 0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x45,
+	0x7f, 0x00, 0x92, 0x45, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x3e,
+	0x00, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x45, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x45, 0x00, 0x00, 0x86, 0x45, 0x00, 0x60, 0x81, 0x45, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x45, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x43,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x86, 0x43,
+	0x00, 0x60, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b,
+	0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x37, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x37,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3e, 0x7f, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x2b,
+	0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x96, 0x43,
+	0x0a, 0x60, 0x82, 0x43, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x43,
+	0x00, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x93, 0x37,
+	0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x37,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x37, 0x00, 0x00, 0x86, 0x37,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x96, 0x3a,
+	0x0a, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x37,
+	0x7f, 0x00, 0x94, 0x2b, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x37,
+	0x00, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x84, 0x2b, 0x00, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97, 0x1f,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x86, 0x48,
+	0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x92, 0x3c, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x96, 0x3c,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3c, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3c, 0x00, 0x60, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x82, 0x48, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x48, 0x00, 0x60, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x3c,
+	0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x3c,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x45, 0x00, 0x00, 0x82, 0x3c,
+	0x00, 0x00, 0x85, 0x45, 0x00, 0x00, 0x86, 0x3c, 0x00, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x46,
+	0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x29,
+	0x42, 0x60, 0x81, 0x41, 0x00, 0x00, 0x82, 0x46, 0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x93, 0x29,
+	0x7f, 0x00, 0x84, 0x29, 0x00, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x1d, 0x42, 0x60, 0x81, 0x45, 0x00, 0x00, 0x82, 0x3a,
+	0x00, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x45, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d,
+	0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x82, 0x41,
+	0x00, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x86, 0x41,
+	0x00, 0x60, 0x91, 0x45, 0x7f, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x93, 0x39, 0x7f, 0x00, 0x94, 0x2d,
+	0x7f, 0x00, 0x95, 0x45, 0x0a, 0x00, 0x96, 0x35, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x2d,
+	0x42, 0x60, 0x81, 0x45, 0x00, 0x00, 0x82, 0x35, 0x00, 0x00, 0x85, 0x45, 0x00, 0x00, 0x86, 0x35,
+	0x00, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x39, 0x00, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x84, 0x2d, 0x00, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x2d, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x44,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3a,
+	0x0a, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x86, 0x49,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x3d, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x3d, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3d,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x3d,
+	0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x31, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x86, 0x49,
+	0x00, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x3d, 0x7f, 0x00, 0x83, 0x3d,
+	0x00, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x85, 0x49,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x3d, 0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x25,
+	0x42, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x86, 0x3d,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x3d,
+	0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x44,
+	0x0a, 0x00, 0x87, 0x25, 0x00, 0x00, 0x97, 0x31, 0x42, 0x60, 0x82, 0x44, 0x00, 0x00, 0x86, 0x44,
+	0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x83, 0x3d,
+	0x00, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x38, 0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x25,
+	0x42, 0x60, 0x82, 0x38, 0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x86, 0x38,
+	0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x31,
+	0x7f, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x41,
+	0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x86, 0x41,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x3d,
+	0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48,
+	0x0a, 0x00, 0x87, 0x25, 0x00, 0x00, 0x97, 0x31, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x86, 0x48,
+	0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x3d,
+	0x00, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x48,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x44,
+	0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x49, 0x00, 0x60, 0x92, 0x3d, 0x7f, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3d, 0x0a, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3d, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x3d, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x3d,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3d, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x4b,
+	0x7f, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x3d, 0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x31,
+	0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x4b,
+	0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x31,
+	0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x3f,
+	0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x25, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x3f,
+	0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x94, 0x25,
+	0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b,
+	0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x4b,
+	0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x3d, 0x7f, 0x00, 0x94, 0x31,
+	0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x25, 0x00, 0x00, 0x97, 0x31,
+	0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x3f,
+	0x00, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x38,
+	0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x82, 0x49,
+	0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x86, 0x49, 0x00, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x83, 0x38,
+	0x00, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x48,
+	0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x20, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x48, 0x00, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x93, 0x2c,
+	0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x83, 0x2c,
+	0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x44, 0x00, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x93, 0x3c,
+	0x7f, 0x00, 0x94, 0x30, 0x7f, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x30,
+	0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x85, 0x48, 0x00, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x46,
+	0x7f, 0x00, 0x83, 0x3c, 0x00, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x84, 0x30, 0x00, 0x00, 0x94, 0x2e,
+	0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x30, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x44,
+	0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x44,
+	0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a, 0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x44,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e,
+	0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x3d, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x3d,
+	0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22, 0x42, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x2e,
+	0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3d, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x49,
+	0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x3d, 0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x31,
+	0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x3d, 0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x84, 0x31,
+	0x00, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x3d,
+	0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x25, 0x42, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x31,
+	0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x86, 0x3d, 0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x3d, 0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x46,
+	0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x44, 0x0a, 0x00, 0x87, 0x25, 0x00, 0x00, 0x97, 0x31,
+	0x42, 0x60, 0x82, 0x44, 0x00, 0x00, 0x86, 0x44, 0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x44,
+	0x7f, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x84, 0x31,
+	0x00, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x38,
+	0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x25, 0x42, 0x60, 0x82, 0x38, 0x00, 0x00, 0x83, 0x31,
+	0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x86, 0x38, 0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x41,
+	0x7f, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x85, 0x44,
+	0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x83, 0x31,
+	0x00, 0x00, 0x84, 0x25, 0x00, 0x00, 0x86, 0x41, 0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x48,
+	0x7f, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x3d, 0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x41,
+	0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96, 0x48, 0x0a, 0x00, 0x87, 0x25, 0x00, 0x00, 0x97, 0x31,
+	0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91, 0x46,
+	0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x84, 0x31,
+	0x00, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x92, 0x3a, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e,
+	0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3a, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x41, 0x7f, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x2e,
+	0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x96, 0x46,
+	0x0a, 0x60, 0x82, 0x46, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x46,
+	0x00, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x96, 0x3a,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x3a, 0x00, 0x00, 0x86, 0x3a,
+	0x00, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x44,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x49,
+	0x00, 0x60, 0x92, 0x3d, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x96, 0x3d,
+	0x0a, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3d,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93, 0x3a,
+	0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x96, 0x49,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x86, 0x49,
+	0x00, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x3d, 0x7f, 0x00, 0x83, 0x3a,
+	0x00, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x49,
+	0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x3d, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97, 0x22,
+	0x42, 0x60, 0x82, 0x3d, 0x00, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84, 0x22, 0x00, 0x00, 0x86, 0x3d,
+	0x00, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x3d,
+	0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b,
+	0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x31, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b,
+	0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x4b, 0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x25,
+	0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x25,
+	0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25,
+	0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x4b,
+	0x7f, 0x00, 0x93, 0x31, 0x7f, 0x00, 0x94, 0x25, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x4b,
+	0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x83, 0x31, 0x00, 0x00, 0x84, 0x25,
+	0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x4b, 0x00, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x92, 0x3f,
+	0x7f, 0x00, 0x93, 0x3d, 0x7f, 0x00, 0x94, 0x31, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x96, 0x3f,
+	0x0a, 0x00, 0x87, 0x25, 0x00, 0x00, 0x97, 0x31, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f,
+	0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x49,
+	0x7f, 0x00, 0x83, 0x3d, 0x00, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x84, 0x31, 0x00, 0x00, 0x94, 0x2c,
+	0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x31, 0x00, 0x00, 0x97, 0x2c,
+	0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c,
+	0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x49, 0x00, 0x85, 0x25, 0x91, 0x48, 0x7f, 0x00, 0x92,
+	0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x96,
+	0x48, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92,
+	0x30, 0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x43, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95,
+	0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97,
+	0x24, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84,
+	0x24, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x43, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94,
+	0x18, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96,
+	0x43, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92,
+	0x30, 0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x43, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95,
+	0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97,
+	0x24, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84,
+	0x24, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94,
+	0x18, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96,
+	0x3f, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93,
+	0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84,
+	0x1d, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x52, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91,
+	0x3a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92,
+	0x46, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95,
+	0x35, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91,
+	0x52, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91,
+	0x3a, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92,
+	0x32, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x32, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91,
+	0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x32, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92,
+	0x46, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93,
+	0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84,
+	0x1d, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91,
+	0x3a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4d, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x18, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x85,
+	0x48, 0x00, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82,
+	0x30, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96,
+	0x3f, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95,
+	0x37, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91,
+	0x48, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94,
+	0x24, 0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96,
+	0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85,
+	0x48, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82,
+	0x30, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95,
+	0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97,
+	0x18, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95,
+	0x37, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91,
+	0x48, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94,
+	0x18, 0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96,
+	0x48, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x85,
+	0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x37, 0x0a, 0x60, 0x91, 0x4f, 0x7f, 0x00, 0x82,
+	0x37, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x4f, 0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96,
+	0x3f, 0x0a, 0x60, 0x81, 0x4f, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x4f, 0x00, 0x00, 0x95,
+	0x37, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91,
+	0x48, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94,
+	0x2b, 0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96,
+	0x48, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x30, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x84,
+	0x2b, 0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96,
+	0x37, 0x0a, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x37, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x30, 0x00, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97,
+	0x1f, 0x42, 0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84,
+	0x1f, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x82, 0x30, 0x00, 0x00, 0x92,
+	0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96,
+	0x48, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92,
+	0x30, 0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x43, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95,
+	0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97,
+	0x24, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84,
+	0x24, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x43, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94,
+	0x18, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96,
+	0x43, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x82, 0x48, 0x00, 0x00, 0x92,
+	0x30, 0x7f, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x43, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95,
+	0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x91, 0x48, 0x7f, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94, 0x24, 0x7f, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97,
+	0x24, 0x42, 0x60, 0x82, 0x43, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84,
+	0x24, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x48, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94,
+	0x18, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96,
+	0x3f, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97, 0x18, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82,
+	0x3f, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x43, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93,
+	0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84,
+	0x1d, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x52, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91,
+	0x3a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92,
+	0x46, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95,
+	0x35, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91,
+	0x52, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x52, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00, 0x91,
+	0x3a, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x52, 0x00, 0x00, 0x95, 0x3a, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x3e, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3e, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91, 0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92,
+	0x32, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x32, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x91, 0x41, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x41, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x41, 0x00, 0x00, 0x91,
+	0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x41, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x32, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92,
+	0x46, 0x7f, 0x00, 0x93, 0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x1d, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x29, 0x00, 0x00, 0x84, 0x1d, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93,
+	0x29, 0x7f, 0x00, 0x94, 0x1d, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x60, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x29, 0x00, 0x00, 0x84,
+	0x1d, 0x00, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91,
+	0x3a, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4d, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x3e, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x3e, 0x0a, 0x00, 0x87, 0x1d, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x32, 0x7f, 0x00, 0x82, 0x3e, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x32, 0x0a, 0x00, 0x86, 0x3e, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x60, 0x81, 0x32, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x46, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x85, 0x32, 0x00, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97,
+	0x18, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x85,
+	0x48, 0x00, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82,
+	0x30, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96,
+	0x3f, 0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95,
+	0x37, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91,
+	0x48, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x43, 0x7f, 0x00, 0x93, 0x30, 0x7f, 0x00, 0x94,
+	0x24, 0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96,
+	0x43, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x24, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82,
+	0x43, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x30, 0x00, 0x00, 0x84, 0x24, 0x00, 0x00, 0x85,
+	0x48, 0x00, 0x00, 0x86, 0x43, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x82,
+	0x30, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94, 0x18, 0x7f, 0x00, 0x95,
+	0x43, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x24, 0x00, 0x00, 0x97,
+	0x18, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95,
+	0x37, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91,
+	0x48, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x24, 0x7f, 0x00, 0x94,
+	0x18, 0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96,
+	0x48, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x85,
+	0x48, 0x00, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96, 0x37, 0x0a, 0x60, 0x91, 0x4f, 0x7f, 0x00, 0x82,
+	0x37, 0x00, 0x00, 0x92, 0x3f, 0x7f, 0x00, 0x95, 0x4f, 0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96,
+	0x3f, 0x0a, 0x60, 0x81, 0x4f, 0x00, 0x00, 0x91, 0x37, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92,
+	0x3c, 0x7f, 0x00, 0x83, 0x24, 0x00, 0x00, 0x84, 0x18, 0x00, 0x00, 0x85, 0x4f, 0x00, 0x00, 0x95,
+	0x37, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x3c, 0x0a, 0x60, 0x81, 0x37, 0x00, 0x00, 0x91,
+	0x48, 0x7f, 0x00, 0x82, 0x3c, 0x00, 0x00, 0x92, 0x48, 0x7f, 0x00, 0x93, 0x37, 0x7f, 0x00, 0x94,
+	0x2b, 0x7f, 0x00, 0x85, 0x37, 0x00, 0x00, 0x95, 0x48, 0x0a, 0x00, 0x86, 0x3c, 0x00, 0x00, 0x96,
+	0x48, 0x0a, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x2b, 0x42, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x30, 0x7f, 0x00, 0x82, 0x48, 0x00, 0x00, 0x92, 0x37, 0x7f, 0x00, 0x83, 0x37, 0x00, 0x00, 0x84,
+	0x2b, 0x00, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x30, 0x0a, 0x00, 0x86, 0x48, 0x00, 0x00, 0x96,
+	0x37, 0x0a, 0x60, 0x81, 0x30, 0x00, 0x00, 0x91, 0x48, 0x7f, 0x00, 0x82, 0x37, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x93, 0x2b, 0x7f, 0x00, 0x94, 0x1f, 0x7f, 0x00, 0x85, 0x30, 0x00, 0x00, 0x95,
+	0x48, 0x0a, 0x00, 0x86, 0x37, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2b, 0x00, 0x00, 0x97,
+	0x1f, 0x42, 0x60, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x83, 0x2b, 0x00, 0x00, 0x84,
+	0x1f, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x48, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x48, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4e, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4e, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x4e, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x4e, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x4e, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x50, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x50, 0x00, 0x00, 0x95,
+	0x44, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x38, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x38, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x38, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x38, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95,
+	0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91,
+	0x50, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x60, 0x81, 0x50, 0x00, 0x00, 0x82,
+	0x49, 0x00, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x85, 0x50, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x38, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x38, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x38, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x1b, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82,
+	0x33, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94,
+	0x27, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82,
+	0x33, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97,
+	0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x3a, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3a, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x3f, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91,
+	0x4a, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94,
+	0x2e, 0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x4a, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x3e, 0x7f, 0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x39, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x84,
+	0x2e, 0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96,
+	0x39, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x39, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x39, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97,
+	0x22, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84,
+	0x22, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4e, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4e, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x4e, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x4e, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x4e, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x50, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x50, 0x00, 0x00, 0x95,
+	0x44, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x38, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x38, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x38, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x38, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95,
+	0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91,
+	0x50, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x60, 0x81, 0x50, 0x00, 0x00, 0x82,
+	0x49, 0x00, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x85, 0x50, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x38, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x38, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x38, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x1b, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82,
+	0x33, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94,
+	0x27, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82,
+	0x33, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97,
+	0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x3a, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3a, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x3f, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91,
+	0x4a, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94,
+	0x2e, 0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x4a, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x3e, 0x7f, 0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x39, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x84,
+	0x2e, 0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96,
+	0x39, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x39, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x39, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97,
+	0x22, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84,
+	0x22, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4e, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4e, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x4e, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x4e, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x4e, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x50, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x50, 0x00, 0x00, 0x95,
+	0x44, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x38, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x38, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x38, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x38, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95,
+	0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91,
+	0x50, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x60, 0x81, 0x50, 0x00, 0x00, 0x82,
+	0x49, 0x00, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x85, 0x50, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x38, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x38, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x38, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x1b, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82,
+	0x33, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94,
+	0x27, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x27, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x33, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x82,
+	0x33, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97,
+	0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x91, 0x3a, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x95,
+	0x3a, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x3a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x3a, 0x7f, 0x00, 0x85,
+	0x4b, 0x00, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x3a, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x3a, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x3a, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91, 0x3f, 0x7f, 0x00, 0x82, 0x42, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x3f, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00, 0x91,
+	0x4a, 0x7f, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x92, 0x4a, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94,
+	0x2e, 0x7f, 0x00, 0x85, 0x3f, 0x00, 0x00, 0x95, 0x4a, 0x0a, 0x00, 0x86, 0x3f, 0x00, 0x00, 0x96,
+	0x4a, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x3e, 0x7f, 0x00, 0x82, 0x4a, 0x00, 0x00, 0x92, 0x39, 0x7f, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x84,
+	0x2e, 0x00, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x3e, 0x0a, 0x00, 0x86, 0x4a, 0x00, 0x00, 0x96,
+	0x39, 0x0a, 0x60, 0x81, 0x3e, 0x00, 0x00, 0x91, 0x4a, 0x7f, 0x00, 0x82, 0x39, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2e, 0x7f, 0x00, 0x94, 0x22, 0x7f, 0x00, 0x85, 0x3e, 0x00, 0x00, 0x95,
+	0x4a, 0x0a, 0x00, 0x86, 0x39, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2e, 0x00, 0x00, 0x97,
+	0x22, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x32, 0x7f, 0x00, 0x83, 0x2e, 0x00, 0x00, 0x84,
+	0x22, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x32, 0x0a, 0x60, 0x81, 0x4a, 0x00, 0x00, 0x91,
+	0x4b, 0x7f, 0x00, 0x82, 0x32, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4a, 0x00, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x86, 0x32, 0x00, 0x00, 0x96,
+	0x4b, 0x0a, 0x00, 0x87, 0x22, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4e, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4e, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4e, 0x00, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x46, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94, 0x1b, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x82, 0x4b, 0x00, 0x00, 0x92,
+	0x33, 0x7f, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96, 0x33, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x46, 0x7f, 0x00, 0x82, 0x33, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95,
+	0x46, 0x0a, 0x00, 0x86, 0x33, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x46, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x42, 0x0a, 0x60, 0x91, 0x4b, 0x7f, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x27, 0x42, 0x60, 0x82, 0x46, 0x00, 0x00, 0x92, 0x4b, 0x7f, 0x00, 0x83, 0x33, 0x00, 0x00, 0x84,
+	0x27, 0x00, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x4b, 0x0a, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x91,
+	0x4e, 0x7f, 0x00, 0x82, 0x4b, 0x00, 0x00, 0x92, 0x42, 0x7f, 0x00, 0x93, 0x27, 0x7f, 0x00, 0x94,
+	0x1b, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x4e, 0x0a, 0x00, 0x86, 0x4b, 0x00, 0x00, 0x96,
+	0x42, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00, 0x97, 0x1b, 0x42, 0x60, 0x81, 0x4e, 0x00, 0x00, 0x82,
+	0x42, 0x00, 0x00, 0x92, 0x46, 0x7f, 0x00, 0x83, 0x27, 0x00, 0x00, 0x84, 0x1b, 0x00, 0x00, 0x85,
+	0x4e, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x96, 0x46, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82,
+	0x46, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x46, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x1b, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84, 0x2c, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x50, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x50, 0x00, 0x00, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x50, 0x00, 0x00, 0x95,
+	0x44, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93, 0x38, 0x7f, 0x00, 0x94,
+	0x2c, 0x7f, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x41, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x4d, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x41, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91, 0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92,
+	0x35, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x44, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95, 0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x91, 0x44, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x44, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x44, 0x00, 0x00, 0x91,
+	0x38, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x95, 0x38, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x35, 0x0a, 0x60, 0x81, 0x38, 0x00, 0x00, 0x91, 0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92,
+	0x49, 0x7f, 0x00, 0x93, 0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x85, 0x38, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x20, 0x42, 0x60, 0x81, 0x49, 0x00, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x83,
+	0x2c, 0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x85, 0x49, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x44, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x2c, 0x7f, 0x00, 0x94, 0x20, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x60, 0x82, 0x41, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x83, 0x2c, 0x00, 0x00, 0x84,
+	0x20, 0x00, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x49, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x44, 0x7f, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95,
+	0x49, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x44, 0x0a, 0x60, 0x81, 0x49, 0x00, 0x00, 0x91,
+	0x3d, 0x7f, 0x00, 0x82, 0x44, 0x00, 0x00, 0x92, 0x35, 0x7f, 0x00, 0x85, 0x49, 0x00, 0x00, 0x95,
+	0x3d, 0x0a, 0x00, 0x86, 0x44, 0x00, 0x00, 0x96, 0x35, 0x0a, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91,
+	0x50, 0x7f, 0x00, 0x82, 0x35, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95,
+	0x50, 0x0a, 0x00, 0x86, 0x35, 0x00, 0x00, 0x96, 0x49, 0x0a, 0x60, 0x81, 0x50, 0x00, 0x00, 0x82,
+	0x49, 0x00, 0x00, 0x92, 0x38, 0x7f, 0x00, 0x85, 0x50, 0x00, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96,
+	0x38, 0x0a, 0x60, 0x91, 0x4d, 0x7f, 0x00, 0x82, 0x38, 0x00, 0x00, 0x92, 0x41, 0x7f, 0x00, 0x93,
+	0x38, 0x7f, 0x00, 0x94, 0x2c, 0x7f, 0x00, 0x95, 0x4d, 0x0a, 0x00, 0x86, 0x38, 0x00, 0x00, 0x96,
+	0x41, 0x0a, 0x00, 0x87, 0x20, 0x00, 0x00, 0x97, 0x2c, 0x42, 0x60, 0x81, 0x4d, 0x00, 0x00, 0x91,
+	0x35, 0x7f, 0x00, 0x82, 0x41, 0x00, 0x00, 0x92, 0x49, 0x7f, 0x00, 0x83, 0x38, 0x00, 0x00, 0x84,
+	0x2c, 0x00, 0x00, 0x85, 0x4d, 0x00, 0x00, 0x95, 0x35, 0x0a, 0x00, 0x86, 0x41, 0x00, 0x00, 0x96,
+	0x49, 0x0a, 0x60, 0x81, 0x35, 0x00, 0x00, 0x91, 0x4b, 0x7f, 0x00, 0x82, 0x49, 0x00, 0x00, 0x92,
+	0x3f, 0x7f, 0x00, 0x93, 0x3f, 0x7f, 0x00, 0x94, 0x33, 0x7f, 0x00, 0x85, 0x35, 0x00, 0x00, 0x95,
+	0x4b, 0x0a, 0x00, 0x86, 0x49, 0x00, 0x00, 0x96, 0x3f, 0x0a, 0x00, 0x87, 0x2c, 0x00, 0x00, 0x97,
+	0x33, 0x42, 0x60, 0x81, 0x4b, 0x00, 0x00, 0x82, 0x3f, 0x00, 0x00, 0x83, 0x3f, 0x00, 0x00, 0x84,
+	0x33, 0x00, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x85, 0x25, 0x91, 0x4b, 0x7f, 0x00,
+	0x93, 0x33, 0x7f, 0x00, 0x94, 0x27, 0x7f, 0x00, 0x95, 0x4b, 0x0a, 0x00, 0x87, 0x33, 0x00, 0x00,
+	0x97, 0x27, 0x42, 0x60, 0x83, 0x33, 0x00, 0x00, 0x84, 0x27, 0x00, 0x60, 0x81, 0x4b, 0x00, 0x00,
+	0x91, 0x3f, 0x7f, 0x00, 0x85, 0x4b, 0x00, 0x00, 0x95, 0x3f, 0x0a, 0x60, 0x81, 0x3f, 0x00, 0x00,
+	0x85, 0x3f, 0x00, 0x60, 0x91, 0x46, 0x7f, 0x00, 0x92, 0x52, 0x7f, 0x00, 0x93, 0x46, 0x7f, 0x00,
+	0x94, 0x3a, 0x7f, 0x00, 0x95, 0x46, 0x0a, 0x00, 0x96, 0x52, 0x0a, 0x00, 0x87, 0x27, 0x00, 0x00,
+	0x97, 0x3a, 0x42, 0x60, 0x81, 0x46, 0x00, 0x00, 0x82, 0x52, 0x00, 0x00, 0x83, 0x46, 0x00, 0x00,
+	0x84, 0x3a, 0x00, 0x00, 0x85, 0x46, 0x00, 0x00, 0x86, 0x52, 0x00, 0x60, 0x91, 0x52, 0x7f, 0x00,
+	0x92, 0x52, 0x7f, 0x00, 0x93, 0x3a, 0x7f, 0x00, 0x94, 0x2e, 0x7f, 0x00, 0x95, 0x52, 0x0a, 0x00,
+	0x96, 0x52, 0x0a, 0x00, 0x87, 0x3a, 0x00, 0x00, 0x97, 0x2e, 0x42, 0x60, 0x81, 0x52, 0x00, 0x00,
+	0x82, 0x52, 0x00, 0x00, 0x83, 0x3a, 0x00, 0x00, 0x84, 0x2e, 0x00, 0x00, 0x85, 0x52, 0x00, 0x00,
+	0x86, 0x52, 0x00, 0xb1, 0x10, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f,
+	0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x00, 0x87, 0x2e, 0x00,
+	0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00,
+	0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c,
+	0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c,
+	0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91,
+	0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95,
+	0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40,
+	0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00,
+	0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00,
+	0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81,
+	0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f,
+	0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00,
+	0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00,
+	0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35,
+	0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30,
+	0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83,
+	0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x82, 0x20, 0x91, 0x3c, 0x7f, 0x00,
+	0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00,
+	0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x91, 0x3d, 0x7f, 0x00,
+	0x82, 0x30, 0x00, 0x00, 0x92, 0x31, 0x7f, 0x00, 0x93, 0x42, 0x7f, 0x00, 0x94, 0x36, 0x7f, 0x00,
+	0x95, 0x3d, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x31, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00,
+	0x97, 0x36, 0x42, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x82, 0x31, 0x00, 0x00, 0x83, 0x42, 0x00, 0x00,
+	0x84, 0x36, 0x00, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x86, 0x31, 0x00, 0x60, 0x91, 0x3c, 0x7f, 0x00,
+	0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00,
+	0x96, 0x30, 0x0a, 0x00, 0x87, 0x36, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x3c, 0x00, 0x00,
+	0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00,
+	0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f,
+	0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00,
+	0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00,
+	0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c,
+	0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30,
+	0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81,
+	0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82,
+	0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00,
+	0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60,
+	0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60,
+	0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f,
+	0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a,
+	0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00,
+	0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30,
+	0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30,
+	0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c,
+	0x00, 0x60, 0x91, 0x43, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x43,
+	0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x93, 0x42, 0x7f, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x94, 0x36, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x36,
+	0x42, 0x60, 0x91, 0x3c, 0x7f, 0x00, 0x83, 0x42, 0x00, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x84, 0x36,
+	0x00, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x87, 0x36, 0x00, 0x00, 0x97, 0x29,
+	0x42, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x43,
+	0x0a, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3d, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x31,
+	0x7f, 0x00, 0x83, 0x35, 0x00, 0x00, 0x93, 0x42, 0x7f, 0x00, 0x84, 0x29, 0x00, 0x00, 0x94, 0x36,
+	0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x31,
+	0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x36, 0x42, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x91, 0x43,
+	0x7f, 0x00, 0x82, 0x31, 0x00, 0x00, 0x83, 0x42, 0x00, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x84, 0x36,
+	0x00, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x00, 0x86, 0x31,
+	0x00, 0x00, 0x87, 0x36, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x43, 0x00, 0x00, 0x91, 0x3c,
+	0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30,
+	0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c,
+	0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92,
+	0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96,
+	0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85,
+	0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00,
+	0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00,
+	0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00,
+	0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f,
+	0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a,
+	0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00,
+	0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c,
+	0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c,
+	0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29,
+	0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91,
+	0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95,
+	0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84,
+	0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40,
+	0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00,
+	0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00,
+	0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x82, 0x20, 0x91, 0x3c, 0x7f, 0x00, 0x93, 0x35, 0x7f,
+	0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00,
+	0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x91, 0x3d, 0x7f, 0x00, 0x82, 0x30, 0x00,
+	0x00, 0x92, 0x31, 0x7f, 0x00, 0x93, 0x42, 0x7f, 0x00, 0x94, 0x36, 0x7f, 0x00, 0x95, 0x3d, 0x0a,
+	0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x31, 0x0a, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x36, 0x42,
+	0x60, 0x81, 0x3d, 0x00, 0x00, 0x82, 0x31, 0x00, 0x00, 0x83, 0x42, 0x00, 0x00, 0x84, 0x36, 0x00,
+	0x00, 0x85, 0x3d, 0x00, 0x00, 0x86, 0x31, 0x00, 0x60, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f,
+	0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a,
+	0x00, 0x87, 0x36, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35, 0x00,
+	0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30, 0x00,
+	0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29,
+	0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83, 0x35,
+	0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86, 0x30,
+	0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00, 0x83,
+	0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00, 0x86,
+	0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00,
+	0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00, 0x00,
+	0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00, 0x00,
+	0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35, 0x7f,
+	0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c, 0x00,
+	0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30, 0x00,
+	0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93, 0x35,
+	0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81, 0x3c,
+	0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x82, 0x30,
+	0x00, 0x00, 0x86, 0x30, 0x00, 0x81, 0x40, 0x91, 0x3c, 0x7f, 0x00, 0x92, 0x30, 0x7f, 0x00, 0x93,
+	0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x96, 0x30, 0x0a, 0x60, 0x81,
+	0x3c, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x84, 0x29, 0x00, 0x00, 0x85, 0x3c, 0x00, 0x60, 0x91,
+	0x43, 0x7f, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x94, 0x29, 0x7f, 0x00, 0x95, 0x43, 0x0a, 0x60, 0x81,
+	0x43, 0x00, 0x00, 0x83, 0x35, 0x00, 0x00, 0x93, 0x42, 0x7f, 0x00, 0x84, 0x29, 0x00, 0x00, 0x94,
+	0x36, 0x7f, 0x00, 0x85, 0x43, 0x00, 0x00, 0x87, 0x29, 0x00, 0x00, 0x97, 0x36, 0x42, 0x60, 0x91,
+	0x3c, 0x7f, 0x00, 0x83, 0x42, 0x00, 0x00, 0x93, 0x35, 0x7f, 0x00, 0x84, 0x36, 0x00, 0x00, 0x94,
+	0x29, 0x7f, 0x00, 0x95, 0x3c, 0x0a, 0x00, 0x87, 0x36, 0x00, 0x00, 0x97, 0x29, 0x42, 0x60, 0x81,
+	0x3c, 0x00, 0x00, 0x91, 0x43, 0x7f, 0x00, 0x85, 0x3c, 0x00, 0x00, 0x95, 0x43, 0x0a, 0x60, 0x81,
+	0x43, 0x00, 0x00, 0x91, 0x3d, 0x7f, 0x00, 0x82, 0x30, 0x00, 0x00, 0x92, 0x31, 0x7f, 0x00, 0x83,
+	0x35, 0x00, 0x00, 0x93, 0x42, 0x7f, 0x00, 0x84, 0x29, 0x00, 0x00, 0x94, 0x36, 0x7f, 0x00, 0x85,
+	0x43, 0x00, 0x00, 0x95, 0x3d, 0x0a, 0x00, 0x86, 0x30, 0x00, 0x00, 0x96, 0x31, 0x0a, 0x00, 0x87,
+	0x29, 0x00, 0x00, 0x97, 0x36, 0x42, 0x60, 0x81, 0x3d, 0x00, 0x00, 0x82, 0x31, 0x00, 0x00, 0x83,
+	0x42, 0x00, 0x00, 0x84, 0x36, 0x00, 0x00, 0x85, 0x3d, 0x00, 0x00, 0x86, 0x31, 0x00, 0x00, 0x87,
+	0x36, 0x00, 0x00, 0xff, 0x2f, 0x00
+};
+const uint32_t song_mid_len = sizeof(song_mid);
@@ -1,4 +1,6 @@
 #include "synth.h"
+#include "sections.h"
+#include "fx.h"
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
@@ -8,11 +10,20 @@
 
 /***** Main configuration *****/
 
-#define SAMPLERATE 48000
-#define DT (1.0f / SAMPLERATE)
+// set by synth_init()
+static float samplerate = SYNTH_SAMPLERATE;
+static float dt = 1.0 / SYNTH_SAMPLERATE;
+#define SAMPLERATE samplerate
+#define DT dt
 #define PI 3.14159265358979323846
 typedef float sample;
 
+/*
+ * Per sample voice code: always inlined into the per kind render loops, so
+ * it needs no placement of its own.
+ */
+#define VOICEFUNC static inline __attribute__((always_inline))
+
 
 /***** Core pipeline definitions: channels, instruments, ADSR *****/
 
@@ -22,11 +33,103 @@ typedef struct AdsrParams {
 
 typedef struct Channel Channel;
 
+/*
+ * Modulated per voice values, evaluated from the instrument's routes once per
+ * block. The per sample code only reads these, so adding a route costs
+ * nothing per sample.
+ */
+typedef struct Mod {
+	float pitch; // frequency ratio
+	float dpwnorm; // 1 / pitch, keeps dpw output level
+	float lpcoef, hpcoef; // from the modulated cutoff
+	float duty;
+	float gainl, gainr; // velocity * amplitude * pan law
+} Mod;
+
+typedef struct ModRoute ModRoute;
+
+/*
+ * Every instrument's voices are summed into its own bus. The bus goes
+ * through an optional insert effect, then into the master at level and
+ * into the shared effects (chorus, delay, reverb) at the send levels.
+ */
+enum {
+	INSERT_NONE,
+	INSERT_DIST, // a: drive, 1..
+	INSERT_FILTER, // resonant lowpass, a: cutoff Hz, b: resonance 0..1
+	INSERT_CRUSH, // a: bits, b: sample hold count
+};
+
+typedef struct BusParams {
+	int insert;
+	float a, b; // insert parameters
+	float level;
+	float send[FX_NUM_SENDS];
+} BusParams;
+
+/*
+ * A recorded sound in flash, played over a key range. Frames are 16 bit
+ * little endian pcm, u-law bytes or 4 bit ima adpcm, low nibble first.
+ */
+enum {
+	SAMPLE_PCM,
+	SAMPLE_ULAW,
+	SAMPLE_ADPCM,
+};
+
+typedef struct SampleZone {
+	const uint8_t *data;
+	uint32_t len; // frames
+	uint32_t loopstart, loopend; // frames, no loop if equal
+	int16_t looppred; // adpcm decoder state at loopstart
+	uint8_t loopindex;
+	uint8_t codec;
+	uint8_t lo, hi; // key range
+	uint8_t root; // note that plays at the recorded pitch
+	float rate; // recorded frames per second
+} SampleZone;
+
+/*
+ * FM voice: up to FM_MAX_OPS sine operators. Operator 0 is always a
+ * carrier; every other one either modulates the phase of a lower numbered
+ * operator or is a carrier too, which covers stacks, pairs, branches and
+ * additive setups. The top operator can modulate itself.
+ */
+#define FM_MAX_OPS 4
+
+typedef struct FmOpParams {
+	float ratio; // to the note frequency
+	float level; // output gain of a carrier, radians of modulation otherwise
+	float decay; // seconds to 1/e, 0 to hold
+	int dst; // operator this one modulates, -1 for a carrier
+} FmOpParams;
+
+typedef struct FmParams {
+	int ops;
+	float feedback; // radians of self modulation on the top operator
+	FmOpParams op[FM_MAX_OPS];
+} FmParams;
+
 typedef struct Instrument {
-	void (*initfunc)(Channel* ch);
-	sample (*oscfunc)(struct Instrument *self, void* state);
-	sample (*filtfunc)(struct Instrument *self, void* state, sample input);
-	AdsrParams adsrparams;
+	int kind; // INSTR_*, selects the oscillator, filter and init, see patches.json
+	AdsrParams adsrtimes; // seconds to 1/e and the sustain level
+	AdsrParams modenvtimes;
+	AdsrParams adsrparams; // per sample coefficients, from the times
+	AdsrParams modenv; // per block coefficients
+	float cutoff; // Hz, before modulation
+	float duty; // before modulation
+	float lforate; // Hz, before modulation
+	float pan; // -1..1 left..right, before modulation
+	float spread; // notes alternate left and right of pan by this, detuned
+	int lanes; // unison saws, up to UNISON_MAX
+	float detune; // unison semitones from the center to the outermost lanes
+	int oversample; // voices run at 1, 2 or 4 times the rate, see bus_render()
+	const SampleZone *zones; // sample player key map
+	int numzones;
+	const FmParams *fm;
+	const ModRoute *routes; // terminated by MOD_SRC_NONE
+	BusParams bus;
+	float bend; // semitones, set by pitch bend
 } Instrument;
 
 #define ADSR_MODE_ATTACK 1
@@ -49,10 +152,14 @@ typedef struct Channel {
 	int note; // contains alive data etc
 	int filtstateaddr;// would be index to a general state array but we have mem for both
 	AdsrState adsrstate;
+	AdsrState modenvstate;
+	float lfophase; // 0..1
+	float spread; // this note's side of the instrument spread, -1..1
+	Mod mod;
 	Instrument* instr;
 	int instrunum;
 	sample velocity;
-	char oscstate[64];
+	char oscstate[128];
 	char filtstate[64];
 } Channel;
 
@@ -62,7 +169,7 @@ typedef struct Channel {
 #define E 2.718281828
 #define TGTCOEF (E/(E-1))
 
-sample adsreval(AdsrParams *params, AdsrState *state, int note) {
+VOICEFUNC sample adsreval(AdsrParams *params, AdsrState *state, int note) {
 	if (note & KEYOFFBIT) {
 		if (state->mode == ADSR_MODE_RELEASE) {
 		} else {
@@ -98,57 +205,183 @@ void adsr_init(AdsrState* state) {
 	state->val = 0.0;
 }
 
+// One pole coefficient for a time constant, when evaluated every n samples.
+static float adsr_coef(float seconds, float n) {
+	return seconds > 0 ? -expm1f(-n / (seconds * SAMPLERATE)) : 1.0;
+}
+
+static void adsr_derive(AdsrParams *coefs, const AdsrParams *times, float n) {
+	coefs->attack = adsr_coef(times->attack, n);
+	coefs->decay = adsr_coef(times->decay, n);
+	coefs->sustain = times->sustain;
+	coefs->release = adsr_coef(times->release, n);
+}
+
 
 /***** Filters *****/
 
-typedef struct LowpassParams {
-	float coef;
-} LowpassParams;
+#define FiltTrivLpK (DT*2*PI)
+#define TRIVIAL_LP_PARM(fc) ((FiltTrivLpK*fc)/(FiltTrivLpK*fc+1))
+#define TRIVIAL_HP_PARM(fc) (1/(1+FiltTrivLpK*fc))
 
 typedef struct LowpassState {
 	float val;
-	float coef;
 } LowpassState;
 
-typedef struct HighpassParams {
-	float coef;
-} HighpassParams;
-
 typedef struct HighpassState {
 	float val;
-	float coef;
 } HighpassState;
 
 
-void trivial_lp_init(void* st, LowpassParams* params) {
+void trivial_lp_init(void* st) {
 	LowpassState *state = st;
-	state->coef = params->coef;
 	state->val = 0.0;
 }
 
-sample trivial_lp_eval(void* st, sample in) {
+VOICEFUNC sample trivial_lp_eval(void* st, sample in, float coef) {
 	LowpassState *state = st;
-	state->val += state->coef * (in - state->val);
+	state->val += coef * (in - state->val);
 	return state->val;
 }
 
-void trivial_hp_init(void* st, HighpassParams* params) {
+void trivial_hp_init(void* st) {
 	HighpassState *state = st;
-	state->coef = params->coef;
 	state->val = 0.0;
 }
 
 // y1 = g * (y0 + x1 - x0)
 //    = g * (x1 + (y0 - x0))
 //    = g * (x1 + stored) [in = x1]
-sample trivial_hp_eval(void* st, sample in) {
+VOICEFUNC sample trivial_hp_eval(void* st, sample in, float coef) {
 	HighpassState *state = st;
 	float b = in + state->val; // b = x1 + (y0 - x0)
-	float y = state->coef * b;
+	float y = coef * b;
 	return state->val = y;
 }
 
 
+/***** Modulation *****/
+
+enum {
+	MOD_SRC_NONE,
+	MOD_SRC_ONE, // constant, for routes without a scaling source
+	MOD_SRC_LFO, // per voice triangle, restarts at note on, -1..1
+	MOD_SRC_GLFO, // free running triangle shared by all voices, -1..1
+	MOD_SRC_ENV, // per voice modulation envelope, 0..1
+	MOD_SRC_VELOCITY, // 0..1
+	MOD_SRC_BEND, // semitones
+	MOD_SRC_CTRL0, // synth_setcontrol() values follow, see synth.h
+	NUM_MOD_SRCS = MOD_SRC_CTRL0 + SYNTH_NUM_CTRLS
+};
+
+#define MOD_SRC_POT(i) (MOD_SRC_CTRL0 + SYNTH_CTRL_POT0 + (i))
+#define MOD_SRC_ACCEL(i) (MOD_SRC_CTRL0 + SYNTH_CTRL_ACCELX + (i))
+
+enum {
+	MOD_DST_PITCH, // semitones
+	MOD_DST_CUTOFF, // octaves
+	MOD_DST_DUTY, // added to duty
+	MOD_DST_AMP, // added to unity gain
+	MOD_DST_LFORATE, // octaves
+	MOD_DST_PAN, // added to pan
+	NUM_MOD_DSTS
+};
+
+/*
+ * dst += amount * src * via. Routes live with their instrument; the
+ * destinations are summed per voice and turned into a Mod once per block.
+ */
+struct ModRoute {
+	uint8_t src;
+	uint8_t via;
+	uint8_t dst;
+	float amount;
+};
+
+#define GLFO_RATE 0.25 // Hz
+#define SPREAD_DETUNE 0.08 // semitones at full spread
+
+// pots and accelerometer, gliding towards synth_setcontrol() targets
+CCM_BSS static float ctrls[SYNTH_NUM_CTRLS];
+static float glfophase;
+static int spreadside; // alternates between notes
+
+static float triangle(float phase) {
+	return phase < 0.5 ? 4 * phase - 1 : 3 - 4 * phase;
+}
+
+static float mod_src(Channel *ch, int src) {
+	switch (src) {
+	case MOD_SRC_ONE: return 1;
+	case MOD_SRC_LFO: return triangle(ch->lfophase);
+	case MOD_SRC_GLFO: return triangle(glfophase);
+	case MOD_SRC_ENV: return ch->modenvstate.val;
+	case MOD_SRC_VELOCITY: return ch->velocity;
+	case MOD_SRC_BEND: return ch->instr->bend;
+	default: return ctrls[src - MOD_SRC_CTRL0];
+	}
+}
+
+static float clampf(float x, float lo, float hi) {
+	return x < lo ? lo : x > hi ? hi : x;
+}
+
+/*
+ * Advance the voice's own modulation sources by one block and recompute its
+ * Mod from the routes.
+ */
+static void mod_eval(Channel *ch, int n) {
+	Instrument *ins = ch->instr;
+	float dst[NUM_MOD_DSTS] = { 0 };
+	const ModRoute *r;
+
+	for (r = ins->routes; r && r->src != MOD_SRC_NONE; r++)
+		dst[r->dst] += r->amount * mod_src(ch, r->src) * mod_src(ch, r->via);
+
+	dst[MOD_DST_PITCH] += ch->spread * SPREAD_DETUNE;
+	float pitch = dst[MOD_DST_PITCH] ? exp2f(dst[MOD_DST_PITCH] / 12) : 1;
+	float fc = ins->cutoff;
+	if (dst[MOD_DST_CUTOFF])
+		fc = clampf(fc * exp2f(dst[MOD_DST_CUTOFF]), 10, 0.45 * SAMPLERATE);
+	fc /= ins->oversample; // the filters run at the voice's rate
+	ch->mod.pitch = pitch;
+	ch->mod.dpwnorm = 1 / pitch;
+	ch->mod.lpcoef = TRIVIAL_LP_PARM(fc);
+	ch->mod.hpcoef = TRIVIAL_HP_PARM(fc);
+	ch->mod.duty = ins->duty + dst[MOD_DST_DUTY];
+
+	// constant power, unity at center like the old mono output
+	float gain = ch->velocity * clampf(1 + dst[MOD_DST_AMP], 0, 4);
+	float pan = clampf(ins->pan + ch->spread + dst[MOD_DST_PAN], -1, 1);
+	float angle = (pan + 1) * (float)(PI / 4);
+	ch->mod.gainl = (float)M_SQRT2 * gain * cosf(angle);
+	ch->mod.gainr = (float)M_SQRT2 * gain * sinf(angle);
+
+	float rate = ins->lforate;
+	if (dst[MOD_DST_LFORATE])
+		rate *= exp2f(dst[MOD_DST_LFORATE]);
+	ch->lfophase += rate * n * DT;
+	if (ch->lfophase >= 1.0)
+		ch->lfophase -= (int)ch->lfophase;
+	adsreval(&ins->modenv, &ch->modenvstate, ch->note);
+}
+
+// Global sources, once per block before the voices.
+static void mod_step(int n) {
+	glfophase += GLFO_RATE * n * DT;
+	if (glfophase >= 1.0)
+		glfophase -= 1.0;
+}
+
+static void mod_note_on(Channel *ch) {
+	spreadside = !spreadside;
+	ch->spread = spreadside ? ch->instr->spread : -ch->instr->spread;
+	ch->lfophase = 0.25; // triangle starts from zero
+	adsr_init(&ch->modenvstate);
+	mod_eval(ch, 0);
+}
+
+
 /***** Oscillators *****/
 
 typedef struct {
@@ -165,377 +398,918 @@ typedef struct {
 typedef struct {
 	OscDpwState saw0;
 	OscDpwState saw1;
-	float duty; // 0=0% (1:0), 1=50% (1:1)
 } PlsDpwState;
 
+#define NOISE_CHUNK 16
+
 typedef struct {
-	uint32_t current;
+	uint32_t x; // xorshift32, never 0
+	int pos; // next in buf
+	float b[3]; // coloring filter
+	float buf[NOISE_CHUNK];
 } OscNoiseState;
 
-#include "sawticks.c"
-#include "dpwcoefs.c"
+#define UNISON_MAX 8
 
+typedef struct {
+	float val[UNISON_MAX]; // saw per lane
+	float tick[UNISON_MAX]; // detuned per lane
+	float prev; // sum of the squared saws
+	float coef;
+	int lanes;
+} OscUnisonState;
+
+/*
+ * The sample player decodes SAMPLE_CHUNK frames at a time into buf and
+ * interpolates between them per output sample; buf[0] is the last frame
+ * of the previous chunk.
+ */
+#define SAMPLE_CHUNK 32
+
+typedef struct {
+	const SampleZone *zone;
+	uint32_t src; // next frame to decode
+	uint32_t end; // loopend, or len without a loop
+	int pred, index; // adpcm decoder
+	float pos; // in buf
+	float step; // frames per output sample, before modulation
+	int16_t buf[SAMPLE_CHUNK + 1];
+} OscSampleState;
+
+// per note, from the sample rate
+CCM_BSS static float sawticks[128]; // saw step, 2 * freq / rate
+
+static void tables_init(void) {
+	for (int note = 0; note < 128; note++) {
+		float freq = 440 * exp2f((note - 69) / 12.0);
+		sawticks[note] = freq / (SAMPLERATE / 2);
+	}
+}
+
+// dpw differentiator scale for a saw step, rate / (4 * freq * (1 - freq / rate))
+static float dpw_coef(float tick) {
+	return 1 / (tick * (2 - tick));
+}
+
+#define SINE_BITS 8 // sinetab has 1 << SINE_BITS quarter wave steps
+#include "sinetab.c"
+
+
+/*
+ * Noise is made NOISE_CHUNK samples at a time. The top 23 random bits go
+ * straight into the mantissa of a float in 1..2, so there's no int to
+ * float conversion or divide. Pink is Paul Kellet's three pole economy
+ * filter (within 0.5 dB above 20 Hz), brown a leaky integrator; both are
+ * scaled to about the level of the white noise.
+ */
+enum {
+	NOISE_WHITE,
+	NOISE_PINK,
+	NOISE_BROWN,
+};
+
+// every voice's generator starts from the next seed, see synth_seed()
+static uint32_t noiseseed = 0x9e3779b9;
+
+static uint32_t xorshift32(uint32_t x) {
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
 
 void osc_noise_init(void* st) {
 	OscNoiseState* state = st;
-	state->current = 1;
+	noiseseed = xorshift32(noiseseed);
+	state->x = noiseseed;
+	state->pos = NOISE_CHUNK;
+	state->b[0] = state->b[1] = state->b[2] = 0;
 }
 
-sample osc_noise_eval(Instrument *self, void *st) {
+VOICEFUNC void noise_fill(OscNoiseState *state, int color) {
+	uint32_t x = state->x;
+	float b0 = state->b[0], b1 = state->b[1], b2 = state->b[2];
+	for (int i = 0; i < NOISE_CHUNK; i++) {
+		x = xorshift32(x);
+		union { uint32_t u; float f; } v = { (x >> 9) | 0x3f800000 };
+		float w = v.f - 1.5; // -0.5..0.5
+		if (color == NOISE_PINK) {
+			b0 = 0.99765 * b0 + w * 0.0990460;
+			b1 = 0.96300 * b1 + w * 0.2965164;
+			b2 = 0.57000 * b2 + w * 1.0526913;
+			w = 0.33 * (b0 + b1 + b2 + w * 0.1848);
+		} else if (color == NOISE_BROWN) {
+			b0 = 0.998 * b0 + w;
+			w = 0.06 * b0;
+		}
+		state->buf[i] = w;
+	}
+	state->x = x;
+	state->b[0] = b0;
+	state->b[1] = b1;
+	state->b[2] = b2;
+	state->pos = 0;
+}
+
+VOICEFUNC sample noise_eval(void *st, int color) {
 	OscNoiseState* state = st;
-	uint32_t x = state->current;
-	x ^= x << 8;
-	x ^= x >> 1;
-	x ^= x << 11;
-	x &= 0xffffff;
-	state->current = x;
-	return (float)x / 0xffffff - 0.5;
+	if (state->pos == NOISE_CHUNK)
+		noise_fill(state, color);
+	return state->buf[state->pos++];
+}
+
+VOICEFUNC sample osc_noise_eval(Instrument *self, void *st, const Mod *mod) {
+	return noise_eval(st, NOISE_WHITE);
 }
 
-void osc_saw_init(void* st, int note) {
+VOICEFUNC sample osc_pink_eval(Instrument *self, void *st, const Mod *mod) {
+	return noise_eval(st, NOISE_PINK);
+}
+
+VOICEFUNC sample osc_brown_eval(Instrument *self, void *st, const Mod *mod) {
+	return noise_eval(st, NOISE_BROWN);
+}
+
+void osc_saw_init(void* st, float tick) {
 	OscSawState* state = st;
-	state->tick = sawticks[note];
+	state->tick = tick;
 	state->val = -1.0;
 }
 
-sample osc_saw_eval(Instrument *self, void* st) {
+VOICEFUNC sample osc_saw_eval(Instrument *self, void* st, const Mod *mod) {
 	OscSawState *state = st;
-	state->val += state->tick;
+	state->val += state->tick * mod->pitch;
 	if (state->val > 1.0)
 		state->val -= 2.0;
 	return state->val;
 }
 
-void osc_dpw_init(void* st, int note) {
+void osc_dpw_init(void* st, float tick) {
 	OscDpwState* state = st;
-	osc_saw_init(st, note);
+	osc_saw_init(st, tick);
 	state->val = 1.0; // prev saw is -1 * -1
-	state->coef = dpwcoefs[note];
+	state->coef = dpw_coef(tick);
 }
 
-sample osc_dpw_eval(Instrument *self, void* st) {
+VOICEFUNC sample osc_dpw_eval(Instrument *self, void* st, const Mod *mod) {
 	OscDpwState *state = st;
-	sample a = osc_saw_eval(self, st);
+	sample a = osc_saw_eval(self, st, mod);
 	a *= a;
 	sample dif = state->val - a;
 	state->val = a;
-	return dif * state->coef;
+	return dif * state->coef * mod->dpwnorm;
 }
 
-void pls_dpw_init(void* st, int note, float duty) {
+void pls_dpw_init(void* st, float tick, float duty) {
 	PlsDpwState* state = st;
-	osc_dpw_init(&state->saw0, note);
-	osc_dpw_init(&state->saw1, note);
+	osc_dpw_init(&state->saw0, tick);
+	osc_dpw_init(&state->saw1, tick);
 	// first advances a bit for phase difference
 	// (starts at 0)
 	state->saw1.saw.val += duty;
-	state->duty = duty;
 }
 
-sample pls_dpw_eval(Instrument *self, void* st) {
-	PlsDpwState *state = st;
-	sample a = osc_dpw_eval(self, &state->saw0);
-
-	// first advances a bit for phase difference
-	// fix duty diff cycle here in case it's haxd with lfo
-	state->saw1.saw.val = state->saw0.saw.val + state->duty;
-	if (state->saw1.saw.val > 1.0)
-		state->saw1.saw.val -= 2.0;
-
-	sample b = osc_dpw_eval(self, &state->saw1);
-	sample c = b - a; // originally -1+duty...duty
-	return c;// + state->duty; // ???
+/*
+ * N detuned saws in one voice. The dpw differentiator is linear, so the
+ * squared lanes are summed first and differentiated once; a lane costs an
+ * add, a wrap and a multiply-add. Detune is small enough for the center
+ * note's dpw coefficient to do for all lanes.
+ */
+void osc_unison_init(void* st, float tick, int lanes, float detune) {
+	OscUnisonState* state = st;
+	state->lanes = lanes;
+	state->prev = 0;
+	for (int i = 0; i < lanes; i++) {
+		// lanes evenly over +-detune semitones
+		float off = lanes > 1 ? detune * (2.0 * i / (lanes - 1) - 1) : 0;
+		state->tick[i] = tick * exp2f(off / 12);
+		// fixed but unrelated start phases so the lanes don't start as one
+		float ph = i * 0.618034;
+		state->val[i] = 2 * (ph - (int)ph) - 1;
+		state->prev += state->val[i] * state->val[i];
+	}
+	state->coef = dpw_coef(tick) / sqrtf(lanes);
 }
 
+VOICEFUNC sample osc_unison_eval(Instrument *self, void* st, const Mod *mod) {
+	OscUnisonState *state = st;
+	float pitch = mod->pitch;
+	float sq = 0;
+	for (int i = 0; i < state->lanes; i++) {
+		float v = state->val[i] + state->tick[i] * pitch;
+		if (v > 1.0)
+			v -= 2.0;
+		state->val[i] = v;
+		sq += v * v;
+	}
+	sample dif = state->prev - sq;
+	state->prev = sq;
+	return dif * state->coef * mod->dpwnorm;
+}
 
-/***** Instruments *****/
+static const int16_t ima_steps[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37,
+	41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173,
+	190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+	724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894,
+	6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289,
+	16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
 
-typedef struct {
-	Instrument base;
-	LowpassParams lp;
-} BassInstrument;
+static const int8_t ima_index[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static void adpcm_decode(OscSampleState *state, int16_t *out, int n) {
+	const uint8_t *d = state->zone->data;
+	uint32_t s = state->src;
+	int pred = state->pred, index = state->index;
+	for (int i = 0; i < n; i++, s++) {
+		int nib = (d[s >> 1] >> ((s & 1) << 2)) & 15;
+		int step = ima_steps[index];
+		int diff = step >> 3;
+		if (nib & 4) diff += step;
+		if (nib & 2) diff += step >> 1;
+		if (nib & 1) diff += step >> 2;
+		pred += nib & 8 ? -diff : diff;
+		if (pred > 32767) pred = 32767;
+		else if (pred < -32768) pred = -32768;
+		index += ima_index[nib & 7];
+		if (index < 0) index = 0;
+		else if (index > 88) index = 88;
+		out[i] = pred;
+	}
+	state->pred = pred;
+	state->index = index;
+}
 
-typedef struct {
-	Instrument base;
-	HighpassParams hp;
-} NoiseInstrument;
+static void ulaw_decode(const uint8_t *d, int16_t *out, int n) {
+	for (int i = 0; i < n; i++) {
+		int u = ~d[i];
+		int t = (((u & 0x0f) << 3) + 0x84) << ((u & 0x70) >> 4);
+		out[i] = u & 0x80 ? 0x84 - t : t - 0x84;
+	}
+}
 
-typedef struct {
-	Instrument base;
-	LowpassParams lp;
-	float dutybase;
-	float dutyampl;
-	AdsrParams lfoadsr;
-} PulseBassInstrument;
+static void pcm_decode(const uint8_t *d, int16_t *out, int n) {
+	for (int i = 0; i < n; i++)
+		out[i] = d[2 * i] | d[2 * i + 1] << 8;
+}
 
-typedef struct {
-	Instrument base;
-	LowpassParams lp;
-	float freqampl;
-	int lfonote;
-} VibratoInstrument;
+// Decode the next n frames, wrapping at the loop; silence after a one shot.
+static void osc_sample_decode(OscSampleState *state, int16_t *out, int n) {
+	const SampleZone *z = state->zone;
+	while (n > 0) {
+		if (state->src >= state->end) {
+			if (!z || z->loopend <= z->loopstart) {
+				memset(out, 0, n * sizeof(*out));
+				return;
+			}
+			state->src = z->loopstart;
+			state->pred = z->looppred;
+			state->index = z->loopindex;
+		}
+		int run = state->end - state->src;
+		if (run > n)
+			run = n;
+		switch (z->codec) {
+		case SAMPLE_PCM:
+			pcm_decode(z->data + 2 * state->src, out, run);
+			break;
+		case SAMPLE_ULAW:
+			ulaw_decode(z->data + state->src, out, run);
+			break;
+		case SAMPLE_ADPCM:
+			adpcm_decode(state, out, run);
+			break;
+		}
+		state->src += run;
+		out += run;
+		n -= run;
+	}
+}
 
-void bass_init(Channel *ch) {
-	BassInstrument *ins = (BassInstrument*)ch->instr;
-	trivial_lp_init(ch->filtstate, &ins->lp);
-	osc_dpw_init(ch->oscstate, ch->note);
+static void osc_sample_fill(OscSampleState *state) {
+	state->buf[0] = state->buf[SAMPLE_CHUNK];
+	osc_sample_decode(state, state->buf + 1, SAMPLE_CHUNK);
 }
 
-sample bass_filt(Instrument *self, void* st, sample in) {
-	BassInstrument *bass = (BassInstrument*)self;
-	LowpassState *state = st;
-	state->coef = bass->lp.coef;
-	return trivial_lp_eval(state, in);
+void osc_sample_init(void* st, int note, const SampleZone *zones, int numzones, int os) {
+	OscSampleState* state = st;
+	const SampleZone *z = NULL;
+	for (int i = 0; i < numzones; i++) {
+		if (note >= zones[i].lo && note <= zones[i].hi) {
+			z = &zones[i];
+			break;
+		}
+	}
+	state->zone = z;
+	state->src = 0;
+	state->end = z ? (z->loopend > z->loopstart ? z->loopend : z->len) : 0;
+	state->pred = 0;
+	state->index = 0;
+	state->step = z ? z->rate * DT / os * exp2f((note - z->root) / 12.0) : 0;
+	state->buf[SAMPLE_CHUNK] = 0;
+	osc_sample_fill(state);
+	state->pos = 1; // buf[1] is the first frame
 }
 
-void noise_init(Channel *ch) {
-	NoiseInstrument *ins = (NoiseInstrument*)ch->instr;
-	trivial_hp_init(ch->filtstate, &ins->hp);
-	osc_noise_init(ch->oscstate);
+VOICEFUNC sample osc_sample_eval(Instrument *self, void* st, const Mod *mod) {
+	OscSampleState *state = st;
+	int i = (int)state->pos;
+	float f = state->pos - i;
+	float a = state->buf[i], b = state->buf[i + 1];
+	state->pos += state->step * mod->pitch;
+	while (state->pos >= SAMPLE_CHUNK) {
+		state->pos -= SAMPLE_CHUNK;
+		osc_sample_fill(state);
+	}
+	return (a + f * (b - a)) * (1.0 / 32768);
 }
 
-sample noise_filt(Instrument *self, void* st, sample in) {
-	NoiseInstrument *inst = (NoiseInstrument*)self;
-	HighpassState *state = st;
-	state->coef = inst->hp.coef;
-	return trivial_hp_eval(state, in);
+/*
+ * q15 sine of a 32 bit phase, interpolated from the quarter wave table.
+ */
+VOICEFUNC int sine_q15(uint32_t phase) {
+	uint32_t quad = phase >> 30;
+	uint32_t i = (phase >> (30 - SINE_BITS)) & ((1 << SINE_BITS) - 1);
+	int frac = (phase >> (14 - SINE_BITS)) & 0xffff;
+	int a, b;
+	if (quad & 1) {
+		a = sinetab[(1 << SINE_BITS) - i];
+		b = sinetab[(1 << SINE_BITS) - i - 1];
+	} else {
+		a = sinetab[i];
+		b = sinetab[i + 1];
+	}
+	int y = a + (((b - a) * frac) >> 16);
+	return quad & 2 ? -y : y;
 }
 
-typedef struct PulseBassState {
-	PlsDpwState osc;
-	AdsrState lfoadsr;
-} PulseBassState;
+#define PHASE_ONE 4294967296.0 // one cycle of a 32 bit phase
+// radians to 1/2^24 cycles, shifted to full phase after the conversion to int
+#define FM_RAD_TO_PHASE24 (16777216 / (2 * PI))
 
-void pulsebass_init(Channel *ch) {
-	PulseBassInstrument *ins = (PulseBassInstrument*)ch->instr;
-	trivial_lp_init(ch->filtstate, &ins->lp);
-	pls_dpw_init(ch->oscstate, ch->note, ins->dutybase);
-	PulseBassState *state = (PulseBassState*)ch->oscstate;
-	adsr_init(&state->lfoadsr);
+typedef struct {
+	uint32_t phase[FM_MAX_OPS];
+	uint32_t inc[FM_MAX_OPS];
+	float level[FM_MAX_OPS];
+	float decay[FM_MAX_OPS]; // per sample
+	float tick; // note phase increment, in cycles per sample
+	float pitch; // modulation the increments were computed for
+	float fb; // previous output of the top operator
+} OscFmState;
+
+static void osc_fm_tune(OscFmState *state, const FmParams *p, float pitch) {
+	for (int i = 0; i < p->ops; i++) {
+		float c = state->tick * pitch * p->op[i].ratio;
+		state->inc[i] = (c - (int)c) * PHASE_ONE; // above one cycle aliases anyway
+	}
+	state->pitch = pitch;
 }
 
-sample pulsebass_osc(Instrument *self, void* st) {
-	PulseBassInstrument *ins = (PulseBassInstrument*)self;
-	PulseBassState* state = st;
+void osc_fm_init(void* st, float tick, const FmParams *p, int os) {
+	OscFmState* state = st;
+	state->tick = tick / 2;
+	for (int i = 0; i < p->ops; i++) {
+		state->phase[i] = 0;
+		state->level[i] = p->op[i].level;
+		state->decay[i] = p->op[i].decay > 0 ? 1 - adsr_coef(p->op[i].decay, 1.0 / os) : 1;
+	}
+	state->fb = 0;
+	osc_fm_tune(state, p, 1.0);
+}
 
-	sample adsrval = adsreval(&ins->lfoadsr, &state->lfoadsr, 0);
+/*
+ * Operators from the top down, so each one's modulators have run before
+ * it. The phase stays integer; only the modulation goes through float.
+ */
+VOICEFUNC sample osc_fm_eval(Instrument *self, void* st, const Mod *mod) {
+	OscFmState *state = st;
+	const FmParams *p = self->fm;
+	float in[FM_MAX_OPS] = { 0 };
+	float out = 0;
+	int top = p->ops - 1;
+	if (mod->pitch != state->pitch)
+		osc_fm_tune(state, p, mod->pitch);
+	in[top] = p->feedback * state->fb;
+	for (int i = top; i >= 0; i--) {
+		uint32_t pm = (uint32_t)(int32_t)(in[i] * FM_RAD_TO_PHASE24) << 8;
+		float y = sine_q15(state->phase[i] + pm) * (1.0 / 32768);
+		state->phase[i] += state->inc[i];
+		if (i == top)
+			state->fb = y;
+		y *= state->level[i];
+		state->level[i] *= state->decay[i];
+		if (p->op[i].dst >= 0)
+			in[p->op[i].dst] += y;
+		else
+			out += y;
+	}
+	return out;
+}
 
-	// copy in case of pot/lfo update
-	state->osc.duty = ins->dutybase + ins->dutyampl * adsrval;
+// duty: 0=0% (1:0), 1=50% (1:1)
+VOICEFUNC sample pls_dpw_eval(Instrument *self, void* st, const Mod *mod) {
+	PlsDpwState *state = st;
+	sample a = osc_dpw_eval(self, &state->saw0, mod);
 
-	return pls_dpw_eval(self, st);
+	// first advances a bit for phase difference
+	// fix duty diff cycle here in case it's modulated
+	state->saw1.saw.val = state->saw0.saw.val + mod->duty;
+	if (state->saw1.saw.val > 1.0)
+		state->saw1.saw.val -= 2.0;
+
+	sample b = osc_dpw_eval(self, &state->saw1, mod);
+	sample c = b - a; // originally -1+duty...duty
+	return c;// + state->duty; // ???
 }
 
-sample pulsebass_filt(Instrument *self, void* st, sample in) {
-	return in; // no filt yet
-	PulseBassInstrument *bass = (PulseBassInstrument*)self;
-	LowpassState *state = st;
-	state->coef = bass->lp.coef;
-	return trivial_lp_eval(state, in);
+
+/***** Instruments *****/
+
+/*
+ * The patches are in patches.json, compiled to patches.c by gen_coefs.py.
+ * A patch names an oscillator and a filter; each has a start function
+ * run at note on and a per sample eval, listed in the generator. Every
+ * oscillator and filter pair in use is an instrument kind with its own
+ * render loop, see INSTRUMENT_KINDS.
+ */
+
+// each oscillator keeps its state in the channel
+#define OSCSTATE_FITS(type) \
+	_Static_assert(sizeof(type) <= sizeof(((Channel *)0)->oscstate), #type " too big for oscstate")
+OSCSTATE_FITS(OscDpwState);
+OSCSTATE_FITS(OscNoiseState);
+OSCSTATE_FITS(PlsDpwState);
+OSCSTATE_FITS(OscUnisonState);
+OSCSTATE_FITS(OscSampleState);
+OSCSTATE_FITS(OscFmState);
+
+// saw step of the note at the rate the voice runs at
+static float voice_tick(Channel *ch) {
+	return sawticks[ch->note] / ch->instr->oversample;
 }
 
-typedef struct {
-	PlsDpwState osc;
-	OscDpwState lfo;
-	int orignote;
-} VibratoState;
+static void osc_dpw_start(Channel *ch) {
+	osc_dpw_init(ch->oscstate, voice_tick(ch));
+}
 
-void vibrato_init(Channel *ch) {
-	VibratoInstrument *ins = (VibratoInstrument*)ch->instr;
+static void osc_noise_start(Channel *ch) {
+	osc_noise_init(ch->oscstate);
+}
 
-	trivial_lp_init(ch->filtstate, &ins->lp);
+static void osc_pulse_start(Channel *ch) {
+	pls_dpw_init(ch->oscstate, voice_tick(ch), ch->instr->duty);
+}
 
-	VibratoState *state = (VibratoState*)ch->oscstate;
-	pls_dpw_init(&state->osc, ch->note, 0.5); // hardcoded osc duty
-	osc_dpw_init(&state->lfo, ins->lfonote);
-	state->orignote = ch->note;
+static void osc_unison_start(Channel *ch) {
+	osc_unison_init(ch->oscstate, voice_tick(ch), ch->instr->lanes, ch->instr->detune);
 }
 
-float dpwcoef(float freq) {
-	return SAMPLERATE / (4 * freq * (1 - freq * DT));
+static void osc_sample_start(Channel *ch) {
+	Instrument *ins = ch->instr;
+	osc_sample_init(ch->oscstate, ch->note, ins->zones, ins->numzones, ins->oversample);
 }
 
-float midifreq(int note) {
-	return pow(2, (note - 69) / 12.0) * 440;
+static void osc_fm_start(Channel *ch) {
+	osc_fm_init(ch->oscstate, voice_tick(ch), ch->instr->fm, ch->instr->oversample);
 }
 
-sample vibrato_osc(Instrument *self, void* st) {
-	VibratoInstrument *ins = (VibratoInstrument*)self;
-	VibratoState* state = st;
+static void filt_none_start(Channel *ch) {
+}
 
-#if 0
-	// copy from pot
-	// 0.1 is arbitrarily chosen to make lfo slower than normal notes
-	state->lfo.saw.tick =  sawticks[ins->lfonote];
-	// FIXME vol correction coef
-	state->lfo.coef = dpwcoef(midifreq(ins->lfonote)); // dpwcoefs[ins->lfonote];
-#endif
+VOICEFUNC sample filt_none_eval(Instrument *self, void* st, sample in, const Mod *mod) {
+	return in;
+}
 
-	// execute lfo
-	sample lfoval = osc_dpw_eval(self, &state->lfo);
+static void filt_lp_start(Channel *ch) {
+	trivial_lp_init(ch->filtstate);
+}
 
-	// modulate osc freq
-	int n = state->orignote;
-	float slope = (dpwcoefs[n+1] - dpwcoefs[n]);
-	float newcoef = dpwcoefs[n] + ins->freqampl * lfoval * slope;
-	state->osc.saw0.coef = newcoef;
-	state->osc.saw1.coef = newcoef;
+VOICEFUNC sample filt_lp_eval(Instrument *self, void* st, sample in, const Mod *mod) {
+	return trivial_lp_eval(st, in, mod->lpcoef);
+}
 
-	return pls_dpw_eval(self, &state->osc);
+static void filt_hp_start(Channel *ch) {
+	trivial_hp_init(ch->filtstate);
 }
 
-sample vibrato_filt(Instrument *self, void* st, sample in) {
-	return trivial_lp_eval(st, in);
+VOICEFUNC sample filt_hp_eval(Instrument *self, void* st, sample in, const Mod *mod) {
+	return trivial_hp_eval(st, in, mod->hpcoef);
 }
 
 typedef struct {
 	LowpassState lp[3];
 } TejeezFilt;
 
-void tejeez_init(Channel *ch) {
-	BassInstrument *ins = (BassInstrument*)ch->instr;
+static void filt_tejeez_start(Channel *ch) {
 	TejeezFilt *tjz = (TejeezFilt*)ch->filtstate;
-	trivial_lp_init(&tjz->lp[0], &ins->lp);
-	trivial_lp_init(&tjz->lp[1], &ins->lp);
-	trivial_lp_init(&tjz->lp[2], &ins->lp);
-	osc_dpw_init(ch->oscstate, ch->note);
+	trivial_lp_init(&tjz->lp[0]);
+	trivial_lp_init(&tjz->lp[1]);
+	trivial_lp_init(&tjz->lp[2]);
 }
 
-sample tejeez_filt(Instrument *self, void* st, sample in) {
-	BassInstrument *bass = (BassInstrument*)self;
+VOICEFUNC sample filt_tejeez_eval(Instrument *self, void* st, sample in, const Mod *mod) {
 	TejeezFilt *tjz = st;
-	tjz->lp[0].coef = bass->lp.coef;
-	tjz->lp[1].coef = bass->lp.coef;
-	tjz->lp[2].coef = bass->lp.coef;
+	float coef = mod->lpcoef;
 	sample x = in - 2 * tjz->lp[2].val;
 	if (x < -1) x = -1;
 	else if (x > 1) x = 1;
-	x = trivial_lp_eval(&tjz->lp[0], x);
-	x = trivial_lp_eval(&tjz->lp[1], x);
-	x = trivial_lp_eval(&tjz->lp[2], x);
+	x = trivial_lp_eval(&tjz->lp[0], x, coef);
+	x = trivial_lp_eval(&tjz->lp[1], x, coef);
+	x = trivial_lp_eval(&tjz->lp[2], x, coef);
 	return x;
 }
 
-#define FiltTrivLpK (DT*2*PI)
-#define TRIVIAL_LP_PARM(fc) ((FiltTrivLpK*fc)/(FiltTrivLpK*fc+1))
-#define TRIVIAL_HP_PARM(fc) (1/(1+FiltTrivLpK*fc))
+#define KIND_ENUM(kind, oscstart, osc, filtstart, filt) INSTR_##kind,
 
-/* FIXME: approximate these? pow unavailable here
-	dc	(1-@POW(E,-1.0/(At*RATE)))
-	dc	(1-@POW(E,-1.0/(Dt*RATE)))
-	dc	Sl
-	dc	(1-@POW(E,-1.0/(Rt*RATE)))
-*/
-
-BassInstrument bass = {
-	{
-		bass_init,
-		osc_dpw_eval,
-		bass_filt,
-		{ 0.0004534119168875158,0.00004535044555269668,0.6,0.002267547986504189  } //ADSRBLOCK(0.05, 0.5, 0.8, 0.1),
-	},
-	{ TRIVIAL_LP_PARM(5000) }
-};
+#include "patches.c"
 
-NoiseInstrument noise = {
-	{
-		noise_init,
-		osc_noise_eval,
-		noise_filt,
-		{ 0.188063653849, 6.94420332348e-05, 0.0, 6.94420332348e-05 }
-	},
-	{ TRIVIAL_HP_PARM(5000) }
-};
+#define NUM_INSTRUMENTS (int)(sizeof(instruments) / sizeof(*instruments))
 
-PulseBassInstrument pulsebass = {
-	{
-		pulsebass_init,
-		pulsebass_osc,
-		pulsebass_filt,
-		{ 0.000208311633451, 0.000208311633451, 0.5, 0.000208311633451 }
-	},
-	{ TRIVIAL_LP_PARM(5000) },
-	0.1, 0.9,
-	{ 6.94442033189e-06, 1.0, 1.0, 1.0 }
-};
+// Envelope coefficients for the rate the voices run at; modulation
+// envelopes run per block.
+static void envelopes_init(void) {
+	for (int i = 0; i < NUM_INSTRUMENTS; i++) {
+		Instrument *ins = instruments[i];
+		if (ins->oversample < 1)
+			ins->oversample = 1;
+		adsr_derive(&ins->adsrparams, &ins->adsrtimes, 1.0 / ins->oversample);
+		adsr_derive(&ins->modenv, &ins->modenvtimes, SYNTH_BLOCK);
+	}
+}
 
-VibratoInstrument vibrato = {
-	{
-		vibrato_init,
-		vibrato_osc,
-		vibrato_filt,
-		{ 0.000208311633451, 0.000208311633451, 0.5, 0.000208311633451 }
-	},
-	{ TRIVIAL_LP_PARM(1000) },
-	6.0,
-	0
-};
 
-BassInstrument tejeez = {
-	{
-		tejeez_init,
-		osc_dpw_eval,
-		tejeez_filt,
-		{ 0.0004534119168875158,0.00004535044555269668,0.6,0.002267547986504189  } //ADSRBLOCK(0.05, 0.5, 0.8, 0.1),
-	},
-	{ TRIVIAL_LP_PARM(5000) }
-};
 
+/***** Control rate parameters *****/
+
+// The controls and master volume glide towards their targets once per block
+// instead of jumping, so that coefficient steps don't click.
+#define GLIDE_TIME 0.022 // seconds
+
+static float glidecoef;
+
+typedef struct {
+	float *dst;
+	float target;
+} Glide;
+
+CCM_DATA float mastervol = 1.0;
 
-Instrument* instruments[] = {
-	(Instrument*)&bass,
-	(Instrument*)&noise,
-	(Instrument*)&pulsebass,
-	(Instrument*)&vibrato,
-	(Instrument*)&tejeez,
+enum {
+	GLIDE_CTRL0,
+	GLIDE_MASTERVOL = GLIDE_CTRL0 + SYNTH_NUM_CTRLS,
+	NUM_GLIDES
 };
 
+CCM_BSS static Glide glides[NUM_GLIDES];
+
+static void glide_init(void) {
+	glidecoef = adsr_coef(GLIDE_TIME, SYNTH_BLOCK);
+	for (int i = 0; i < SYNTH_NUM_CTRLS; i++) {
+		glides[GLIDE_CTRL0 + i].dst = &ctrls[i];
+		ctrls[i] = 0; // accelerometer level
+	}
+	glides[GLIDE_MASTERVOL].dst = &mastervol;
+	for (int i = 0; i < SYNTH_NUM_POTS; i++)
+		ctrls[SYNTH_CTRL_POT0 + i] = 0.5; // centered until read
+	for (int i = 0; i < NUM_GLIDES; i++)
+		glides[i].target = *glides[i].dst;
+}
+
+static void glide_set(int i, float target) {
+	glides[i].target = target;
+}
+
+static void glide_step(void) {
+	for (int i = 0; i < NUM_GLIDES; i++) {
+		Glide *g = &glides[i];
+		*g->dst += glidecoef * (g->target - *g->dst);
+	}
+}
+
+
+/***** Buses *****/
+
+typedef struct {
+	sample l[SYNTH_BLOCK], r[SYNTH_BLOCK];
+	int active; // some voice rendered into it this block
+	float low[2], band[2]; // filter insert
+	float hold[2]; // crush insert
+	int holdcount;
+} Bus;
+
+CCM_BSS static Bus buses[NUM_INSTRUMENTS];
+CCM_BSS static sample sendl[FX_NUM_SENDS][SYNTH_BLOCK], sendr[FX_NUM_SENDS][SYNTH_BLOCK];
+
+static void insert_dist(sample *x, int n, float drive) {
+	drive = fmaxf(drive, 0.01f); // no drive would make the makeup gain inf
+	float makeup = (1 + drive) / drive;
+	for (int i = 0; i < n; i++) {
+		float y = drive * x[i];
+		x[i] = makeup * y / (1 + fabsf(y));
+	}
+}
+
+// chamberlin state variable filter, the lowpass output. Stable while
+// f * f + 2 * f * q < 4, which a cutoff up to an eighth of the rate keeps
+// for any resonance.
+static void insert_filter(sample *x, int n, float f, float q, float *low, float *band) {
+	float lo = *low, bp = *band;
+	for (int i = 0; i < n; i++) {
+		lo += f * bp;
+		float hi = x[i] - lo - q * bp;
+		bp += f * hi;
+		x[i] = lo;
+	}
+	*low = lo;
+	*band = bp;
+}
+
+static void insert_crush(sample *x, int n, float levels, int hold, float *held, int count) {
+	float h = *held;
+	for (int i = 0; i < n; i++) {
+		if (count++ % hold == 0)
+			h = floorf(x[i] * levels + 0.5f) / levels;
+		x[i] = h;
+	}
+	*held = h;
+}
+
+RAMFUNC static void bus_insert(const BusParams *p, Bus *bus, int n) {
+	switch (p->insert) {
+	case INSERT_DIST:
+		insert_dist(bus->l, n, p->a);
+		insert_dist(bus->r, n, p->a);
+		break;
+	case INSERT_FILTER: {
+		float f = 2 * sinf((float)PI * clampf(p->a, 10, SAMPLERATE / 8) * DT);
+		float q = 2 * (1 - clampf(p->b, 0, 0.95));
+		insert_filter(bus->l, n, f, q, &bus->low[0], &bus->band[0]);
+		insert_filter(bus->r, n, f, q, &bus->low[1], &bus->band[1]);
+		break;
+	}
+	case INSERT_CRUSH: {
+		float levels = exp2f(p->a - 1);
+		int hold = p->b < 1 ? 1 : p->b;
+		insert_crush(bus->l, n, levels, hold, &bus->hold[0], bus->holdcount);
+		insert_crush(bus->r, n, levels, hold, &bus->hold[1], bus->holdcount);
+		bus->holdcount = (bus->holdcount + n) % hold;
+		break;
+	}
+	}
+}
+
+// Insert, then add the bus to the master and the sends it goes to.
+RAMFUNC static void bus_mix(const BusParams *p, Bus *bus, sample *mixl, sample *mixr, int n) {
+	bus_insert(p, bus, n);
+	for (int i = 0; i < n; i++) {
+		mixl[i] += p->level * bus->l[i];
+		mixr[i] += p->level * bus->r[i];
+	}
+	for (int k = 0; k < FX_NUM_SENDS; k++) {
+		float g = p->send[k];
+		if (g == 0)
+			continue;
+		for (int i = 0; i < n; i++) {
+			sendl[k][i] += g * bus->l[i];
+			sendr[k][i] += g * bus->r[i];
+		}
+	}
+}
+
+
+/***** Oversampling *****/
+
+/*
+ * Instruments with oversample 2 or 4 render their voices at that multiple
+ * of the rate, so the hard clip and the saws fold back less, and are
+ * decimated into their bus by stages of two: the half-band filters in
+ * halfband.c, of which only the odd taps are nonzero.
+ */
+#define OVERSAMPLE_MAX 4
+#include "halfband.c"
+
+#define HB_FIRST_K (int)(sizeof(hbfirst) / sizeof(*hbfirst))
+#define HB_FINAL_K (int)(sizeof(hbfinal) / sizeof(*hbfinal))
+#define HB_FIRST_HIST (4 * HB_FIRST_K - 2)
+#define HB_FINAL_HIST (4 * HB_FINAL_K - 2)
+
+typedef struct {
+	int live; // rendered the previous block, the history is valid
+	sample first[2][HB_FIRST_HIST]; // 4x to 2x input, left and right
+	sample final[2][HB_FINAL_HIST]; // 2x to 1x input
+} Decimator;
+
+// in main ram, there's no room left in CCM
+static Decimator decimators[NUM_INSTRUMENTS];
+
+// voices of the oversampled bus being rendered, after the filter history
+static sample os4[2][HB_FIRST_HIST + 4 * SYNTH_BLOCK];
+static sample os2[2][HB_FINAL_HIST + 2 * SYNTH_BLOCK];
+
+/*
+ * n outputs from 2n inputs in x, after the filter's 4k - 2 samples of
+ * history, which is first restored from hist and then saved back.
+ */
+RAMFUNC static void halfband_decimate(sample *x, sample *hist, const float *h, int k,
+		sample *y, int n) {
+	int len = 4 * k - 2;
+	memcpy(x, hist, len * sizeof(*x));
+	for (int m = 0; m < n; m++) {
+		const sample *c = x + 2 * m + 2 * k; // the center tap
+		float acc = 0.5 * c[0];
+		for (int j = 0; j < k; j++)
+			acc += h[j] * (c[-1 - 2 * j] + c[1 + 2 * j]);
+		y[m] = acc;
+	}
+	memcpy(hist, x + 2 * n, len * sizeof(*x));
+}
+
+// The voices of an oversampled bus have been rendered into os4 or os2.
+RAMFUNC static void bus_decimate(Bus *bus, Decimator *d, int os, int n) {
+	if (!d->live) {
+		memset(d, 0, sizeof(*d));
+		d->live = 1;
+	}
+	for (int c = 0; c < 2; c++) {
+		if (os == 4)
+			halfband_decimate(os4[c], d->first[c], hbfirst, HB_FIRST_K,
+					os2[c] + HB_FINAL_HIST, 2 * n);
+		halfband_decimate(os2[c], d->final[c], hbfinal, HB_FINAL_K,
+				c ? bus->r : bus->l, n);
+	}
+}
 
 
 /***** Core implementation *****/
 
-#define NUM_CHANNELS 16
-static Channel channels[NUM_CHANNELS];
+#define NUM_CHANNELS SYNTH_NUM_CHANNELS
+#define BLOCK SYNTH_BLOCK
+#define MASTER_GAIN 0.25 // one voice at full level is about -12 dB, fx_master limits the rest
+CCM_BSS static Channel channels[NUM_CHANNELS];
+
+/*
+ * One render loop per instrument kind. Returns the number of samples
+ * rendered, less than n if the voice died during the block.
+ */
+#define KIND_RENDER(kind, oscstart, osc, filtstart, filt) \
+RAMFUNC static int render_##kind(Channel *ch, sample *v, int n) { \
+	Instrument *instr = ch->instr; \
+	const Mod mod = ch->mod; \
+	int i; \
+	for (i = 0; i < n; i++) { \
+		sample a = osc(instr, ch->oscstate, &mod); \
+		a = filt(instr, ch->filtstate, a, &mod); \
+		sample c = adsreval(&instr->adsrparams, &ch->adsrstate, ch->note); \
+		if (c < 0.0) { \
+			ch->note |= DEADBIT; \
+			break; \
+		} \
+		v[i] = a * c; \
+	} \
+	return i; \
+}
+INSTRUMENT_KINDS(KIND_RENDER)
+
+/*
+ * The voice itself is mono; only the accumulation into the bus is stereo,
+ * with the gains ramped over the block so pan and level changes don't step.
+ * An oversampled voice renders n * oversample samples.
+ */
+RAMFUNC static void render_channel(Channel* ch, sample* mixl, sample* mixr, int n) {
+	static sample v[BLOCK * OVERSAMPLE_MAX]; // too big for the stack
+	float gl = ch->mod.gainl, gr = ch->mod.gainr;
+	int len, samples = n * ch->instr->oversample;
+
+	mod_eval(ch, n);
+	switch (ch->instr->kind) {
+#define KIND_RENDER_CASE(kind, oscstart, osc, filtstart, filt) \
+	case INSTR_##kind: len = render_##kind(ch, v, samples); break;
+	INSTRUMENT_KINDS(KIND_RENDER_CASE)
+	default: len = 0; break;
+	}
 
-float mastervol = 1.0;
+	float dl = (ch->mod.gainl - gl) / samples, dr = (ch->mod.gainr - gr) / samples;
+	for (int i = 0; i < len; i++) {
+		mixl[i] += gl * v[i];
+		mixr[i] += gr * v[i];
+		gl += dl;
+		gr += dr;
+	}
+}
 
-static sample eval_channel(Channel* ch) {
-	Instrument* instr = ch->instr;
-	sample a = instr->oscfunc(instr, ch->oscstate);
-	sample b = instr->filtfunc ? instr->filtfunc(instr, ch->filtstate, a) : a;
-	sample c = adsreval(&instr->adsrparams, &ch->adsrstate, ch->note);
-	b *= c;
-	if (c < 0.0)
-		ch->note |= DEADBIT;
-	return ch->velocity * b;
+/*
+ * Sum the instrument's live voices into its bus, through the os buffers
+ * and the decimator if it's oversampled.
+ */
+RAMFUNC static void bus_render(int instr, int n) {
+	Bus *bus = &buses[instr];
+	int os = instruments[instr]->oversample;
+	sample *l = bus->l, *r = bus->r;
+	if (os == 4) {
+		l = os4[0] + HB_FIRST_HIST;
+		r = os4[1] + HB_FIRST_HIST;
+	} else if (os == 2) {
+		l = os2[0] + HB_FINAL_HIST;
+		r = os2[1] + HB_FINAL_HIST;
+	}
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		Channel *ch = &channels[i];
+		if ((ch->note & DEADBIT) || ch->instrunum != instr)
+			continue;
+		if (!bus->active) {
+			memset(l, 0, os * n * sizeof(*l));
+			memset(r, 0, os * n * sizeof(*r));
+			bus->active = 1;
+		}
+		render_channel(ch, l, r, n);
+	}
+	if (os > 1) {
+		if (bus->active)
+			bus_decimate(bus, &decimators[instr], os, n);
+		else
+			decimators[instr].live = 0;
+	}
 }
 
 /* public interface */
 
-int32_t synth_sample(void) {
-	sample out = 0;
-	for (int i = 0; i < NUM_CHANNELS; i++) {
-		if (!(channels[i].note & DEADBIT))
-			out += eval_channel(&channels[i]);
+/*
+ * Render frames of interleaved stereo, in blocks of at most BLOCK samples.
+ * Parameters change only between blocks.
+ */
+RAMFUNC void synth_render(int16_t* buf, int frames) {
+	CCM_BSS static sample mixl[BLOCK], mixr[BLOCK];
+	while (frames > 0) {
+		int n = frames < BLOCK ? frames : BLOCK;
+		glide_step();
+		mod_step(n);
+		memset(mixl, 0, sizeof(mixl));
+		memset(mixr, 0, sizeof(mixr));
+		memset(sendl, 0, sizeof(sendl));
+		memset(sendr, 0, sizeof(sendr));
+		for (int i = 0; i < NUM_INSTRUMENTS; i++)
+			bus_render(i, n);
+		for (int i = 0; i < NUM_INSTRUMENTS; i++) {
+			if (buses[i].active)
+				bus_mix(&instruments[i]->bus, &buses[i], mixl, mixr, n);
+			buses[i].active = 0;
+		}
+		fx_chorus(sendl[FX_SEND_CHORUS], sendr[FX_SEND_CHORUS], mixl, mixr, n);
+		fx_delay(sendl[FX_SEND_DELAY], sendr[FX_SEND_DELAY], mixl, mixr, n);
+		fx_reverb(sendl[FX_SEND_REVERB], sendr[FX_SEND_REVERB], mixl, mixr, n);
+		fx_master(mixl, mixr, buf, n, mastervol * MASTER_GAIN);
+		buf += 2 * n;
+		frames -= n;
 	}
-	return 0x7fff * mastervol * 0.1 * out; // FIXME: adaptive filter
 }
 
-void synth_dump(void) {
+/*
+ * Compact voice state, 3 bytes per channel: note with 0x80 set if dead,
+ * instrument << 2 | adsr mode bit number, envelope level 0..255.
+ */
+int synth_dump(uint8_t *buf) {
 	for (int i = 0; i < NUM_CHANNELS; i++) {
 		Channel* ch = &channels[i];
-		printf("ch=%d n=%d adsr=%d:%f\r\n", i, ch->note,
-				ch->adsrstate.mode, (double)ch->adsrstate.val);
+		float lvl = ch->adsrstate.val;
+		lvl = lvl < 0 ? 0 : lvl > 1 ? 1 : lvl;
+		*buf++ = (ch->note & 0x7f) | (ch->note & DEADBIT ? 0x80 : 0);
+		*buf++ = (ch->instrunum << 2) | ((__builtin_ffs(ch->adsrstate.mode) - 1) & 3);
+		*buf++ = 255 * lvl;
 	}
+	return SYNTH_DUMP_SIZE;
 }
 
-void synth_init(void) {
+/*
+ * Can be called again to restart: everything but the noise seed and the
+ * master volume starts over, with the pots centered, the accelerometer
+ * level and no bend, so the same events render the same.
+ */
+void synth_init(int rate) {
+	samplerate = rate;
+	dt = 1.0 / rate;
+	tables_init();
+	envelopes_init();
+	glide_init();
+	fx_init(rate);
+	glfophase = 0;
+	spreadside = 0;
+	memset(decimators, 0, sizeof(decimators));
+	for (int i = 0; i < NUM_INSTRUMENTS; i++)
+		instruments[i]->bend = 0;
 	for (int i = 0; i < NUM_CHANNELS; i++) {
 		channels[i].note |= DEADBIT;
 	}
 }
 
+int synth_samplerate(void) {
+	return SAMPLERATE;
+}
+
 int synth_note_on(int midinote, int instrument, float notevel) {
+	if (instrument < 0 || instrument >= NUM_INSTRUMENTS)
+		return -1;
 	for (int i = 0; i < NUM_CHANNELS; i++) {
 		Channel* ch = &channels[i];
 		if (ch->note & DEADBIT) {
@@ -544,7 +1318,12 @@ int synth_note_on(int midinote, int instrument, float notevel) {
 			ch->velocity = notevel;
 			ch->instrunum = instrument;
 			ch->instr = instruments[instrument];
-			ch->instr->initfunc(ch);
+			switch (ch->instr->kind) {
+#define KIND_INIT_CASE(kind, oscstart, osc, filtstart, filt) \
+			case INSTR_##kind: filtstart(ch); oscstart(ch); break;
+			INSTRUMENT_KINDS(KIND_INIT_CASE)
+			}
+			mod_note_on(ch);
 			return 0;
 		}
 	}
@@ -563,28 +1342,50 @@ int synth_note_off(int midinote, int instrument) {
 	return -1;
 }
 
+void synth_notes_off(int instrument) {
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		Channel* ch = &channels[i];
+		if (ch->instrunum == instrument)
+			ch->note |= KEYOFFBIT;
+	}
+}
+
 void synth_kill(void) {
 	for (int i = 0; i < NUM_CHANNELS; i++)
 		channels[i].note |= DEADBIT;
 }
 
-void synth_setparams(float f, int chan) {
-	switch (chan) {
-	case 0:
-		bass.lp.coef = TRIVIAL_LP_PARM(f/0xfff*5000);
-		noise.hp.coef = TRIVIAL_HP_PARM(f/0xfff*8000);
-		pulsebass.dutybase = f/0xfff;
-		vibrato.freqampl = 10*f/0xfff;
-		break;
-	case 1:
-		vibrato.lfonote = 10*f/0xfff;
-		tejeez.lp.coef = TRIVIAL_LP_PARM(f/0xfff*8000);
-		break;
-	}
+int synth_num_instruments(void) {
+	return NUM_INSTRUMENTS;
+}
+
+void synth_pitchbend(int instrument, float semitones) {
+	if (instrument < 0 || instrument >= NUM_INSTRUMENTS)
+		return;
+	instruments[instrument]->bend = semitones;
+}
+
+/*
+ * Seed the noise oscillators, e.g. from a hardware rng. Without this the
+ * render is the same every run.
+ */
+void synth_seed(uint32_t seed) {
+	if (seed)
+		noiseseed = seed;
+}
+
+/*
+ * Pots and accelerometer axes are modulation sources for the instruments'
+ * routes; the values are reached gradually by the renderer.
+ */
+void synth_setcontrol(int ctrl, float value) {
+	if (ctrl < 0 || ctrl >= SYNTH_NUM_CTRLS)
+		return;
+	glide_set(GLIDE_CTRL0 + ctrl, value);
 }
 
 void synth_setvolume(float f) {
-	mastervol = f;
+	glide_set(GLIDE_MASTERVOL, f);
 }
 
 
@@ -2,14 +2,38 @@
 #define SYNTH_H
 
 #include <stdint.h>
+#include "patches.h" // PATCH_* instrument numbers
 
-void synth_init(void);
-int32_t synth_sample(void);
+#define SYNTH_SAMPLERATE 48000 // default, see synth_init()
+#define SYNTH_NUM_CHANNELS 16
+#define SYNTH_BLOCK 32 // samples between parameter updates
+#define SYNTH_DUMP_SIZE (3 * SYNTH_NUM_CHANNELS)
+#define SYNTH_NUM_POTS 8
+
+// global modulation sources, see synth_setcontrol()
+enum {
+	SYNTH_CTRL_POT0, // 0..1
+	SYNTH_CTRL_ACCELX = SYNTH_CTRL_POT0 + SYNTH_NUM_POTS, // -1..1 per g
+	SYNTH_CTRL_ACCELY,
+	SYNTH_CTRL_ACCELZ,
+	SYNTH_NUM_CTRLS
+};
+
+// Any rate from 8 to 96 kHz; the Audio*HzSettings ones are 8000, 16000,
+// 22050, 32000, 44100, 48000 and 96000. The tables and coefficients are
+// derived for it.
+void synth_init(int samplerate);
+int synth_samplerate(void);
+void synth_render(int16_t* buf, int frames);
 int synth_note_on(int midinote, int instrument, float notevel);
 int synth_note_off(int midinote, int instrument);
-void synth_dump(void);
-void synth_setparams(float f, int chan);
+int synth_dump(uint8_t *buf);
+void synth_setcontrol(int ctrl, float value);
 void synth_setvolume(float f);
 void synth_kill(void);
+void synth_notes_off(int instrument);
+int synth_num_instruments(void);
+void synth_pitchbend(int instrument, float semitones);
+void synth_seed(uint32_t seed);
 
 #endif
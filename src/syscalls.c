@@ -1,5 +1,6 @@
 #include <sys/stat.h>
 #include "stm32f4xx_conf.h"
+#include "uart.h"
 
 int __errno;
 
@@ -63,12 +64,6 @@ caddr_t _sbrk_r (struct _reent *r, int incr)
 }
 
 int _write(int file, char *ptr, int len) {
-	int i;
-
-	for(i = 0;i < len;i++) {
-		USART_SendData(USART2, (uint8_t)ptr[i]);
-		while (USART_GetFlagStatus(USART2, USART_FLAG_TC) == RESET){};
-	}
-
+	uart_write(ptr, len); // queued for dma, dropped if the buffer is full
 	return len;
 }
@@ -0,0 +1,45 @@
+#include "telemetry.h"
+#include "log.h"
+#include "uart.h"
+#include "Audio.h"
+
+// written from the audio interrupt, read and reset from the main loop
+static uint32_t bufperiod;
+static volatile uint32_t rendersum, renderpeak, rendercount;
+static volatile uint32_t rxpeak;
+
+void telemetry_init(uint32_t bufcycles) {
+	bufperiod = bufcycles;
+}
+
+void telemetry_render(uint32_t rendercycles) {
+	rendersum += rendercycles;
+	rendercount++;
+	if (rendercycles > renderpeak)
+		renderpeak = rendercycles;
+}
+
+void telemetry_rxdepth(int depth) {
+	if ((uint32_t)depth > rxpeak)
+		rxpeak = depth;
+}
+
+static uint16_t permille(uint64_t cycles) {
+	return bufperiod ? cycles * 1000 / bufperiod : 0;
+}
+
+void telemetry_send(void) {
+	struct telemetry t;
+	uint32_t n = rendercount;
+
+	t.cpuavg = n ? permille(rendersum / n) : 0;
+	t.cpupeak = permille(renderpeak);
+	rendersum = rendercount = renderpeak = 0;
+	t.underruns = GetAudioUnderruns();
+	t.rxdepth = rxpeak;
+	rxpeak = 0;
+	t.txdrops = uart_txdrops;
+	synth_dump(t.voices);
+
+	log_record(LOG_REC_TELEMETRY, &t, sizeof(t));
+}
@@ -0,0 +1,25 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include "synth.h"
+
+// Periodic binary snapshot of the engine, sent as a LOG_REC_TELEMETRY
+// record. Little endian, decoded by logcat.py and telemetry.py.
+
+#define TELEMETRY_PERIOD_MS 50
+
+struct telemetry {
+	uint16_t cpuavg, cpupeak; // render time, permille of the buffer period
+	uint16_t underruns; // audio dma ran out of buffers, total
+	uint16_t rxdepth; // most midi bytes waiting at once
+	uint16_t txdrops; // log writes dropped, total
+	uint8_t voices[SYNTH_DUMP_SIZE]; // see synth_dump()
+} __attribute__((packed));
+
+void telemetry_init(uint32_t bufcycles);
+void telemetry_render(uint32_t rendercycles);
+void telemetry_rxdepth(int depth);
+void telemetry_send(void);
+
+#endif
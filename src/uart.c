@@ -0,0 +1,233 @@
+#include "uart.h"
+#include "stm32f4xx_conf.h"
+#include "stm32f4xx.h"
+
+// USART2 RX is DMA1 stream 5 channel 4, TX is stream 6 channel 4
+
+#define RXMASK (UART_RXBUFSIZE - 1)
+#define TXMASK (UART_TXBUFSIZE - 1)
+
+static uint8_t rxbuf[UART_RXBUFSIZE];
+static int rxtail;
+volatile uint32_t uart_rxbursts;
+
+/*
+ * The tx counters run freely and wrap; buffer indices are their low bits.
+ * Writers reserve space with a compare-and-swap on txreserved and copy.
+ * Since a writer interrupted by another one always finishes last, the
+ * writer that brings txwriters back to zero publishes everything reserved
+ * so far to the dma by moving txcommitted.
+ */
+static uint8_t txbuf[UART_TXBUFSIZE];
+static volatile uint32_t txreserved, txcommitted, txtail;
+static volatile uint32_t txwriters, txbusy, txlen;
+volatile uint32_t uart_txdrops;
+
+#define TXFLAGS6 (DMA_HIFCR_CTCIF6 | DMA_HIFCR_CHTIF6 | DMA_HIFCR_CTEIF6 \
+		| DMA_HIFCR_CDMEIF6 | DMA_HIFCR_CFEIF6)
+
+static int cas(volatile uint32_t *p, uint32_t old, uint32_t new) {
+	return __sync_bool_compare_and_swap(p, old, new);
+}
+
+static void rxdma_init(void) {
+	DMA_InitTypeDef DMA_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1, ENABLE);
+	DMA_DeInit(DMA1_Stream5);
+
+	DMA_InitStructure.DMA_Channel = DMA_Channel_4;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&USART2->DR;
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rxbuf;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	DMA_InitStructure.DMA_BufferSize = UART_RXBUFSIZE;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low; // audio goes first
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(DMA1_Stream5, &DMA_InitStructure);
+
+	DMA_Cmd(DMA1_Stream5, ENABLE);
+	rxtail = 0;
+}
+
+static void txdma_init(void) {
+	DMA_InitTypeDef DMA_InitStructure;
+
+	DMA_DeInit(DMA1_Stream6);
+
+	DMA_InitStructure.DMA_Channel = DMA_Channel_4;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&USART2->DR;
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)txbuf;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStructure.DMA_BufferSize = 1; // set for each transfer
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(DMA1_Stream6, &DMA_InitStructure);
+	DMA_ITConfig(DMA1_Stream6, DMA_IT_TC, ENABLE);
+
+	txreserved = txcommitted = txtail = 0;
+	txwriters = txbusy = 0;
+
+	NVIC_SetPriority(DMA1_Stream6_IRQn, 9);
+	NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+}
+
+void uart_init(int baudrate) {
+	GPIO_InitTypeDef GPIO_InitStructure;
+	USART_InitTypeDef USART_InitStructure;
+
+	// Clock
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOD, ENABLE);
+
+	// IO
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5 | GPIO_Pin_6;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+	GPIO_InitStructure.GPIO_OType = GPIO_OType_PP; // pushpull
+	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+	GPIO_Init(GPIOD, &GPIO_InitStructure);
+
+	GPIO_PinAFConfig(GPIOD, GPIO_PinSource5, GPIO_AF_USART2);
+	GPIO_PinAFConfig(GPIOD, GPIO_PinSource6, GPIO_AF_USART2);
+
+	// Conf
+	USART_InitStructure.USART_BaudRate = baudrate;
+	USART_InitStructure.USART_WordLength = USART_WordLength_8b;
+	USART_InitStructure.USART_StopBits = USART_StopBits_1;
+	USART_InitStructure.USART_Parity = USART_Parity_No;
+	USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+	USART_InitStructure.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
+	USART_Init(USART2, &USART_InitStructure);
+
+	rxdma_init();
+	txdma_init();
+	USART_DMACmd(USART2, USART_DMAReq_Rx | USART_DMAReq_Tx, ENABLE);
+	USART_ITConfig(USART2, USART_IT_IDLE, ENABLE);
+
+	// below the audio dma (4) so that it never delays rendering
+	NVIC_SetPriority(USART2_IRQn, 8);
+	NVIC_EnableIRQ(USART2_IRQn);
+
+	// Enable
+	USART_Cmd(USART2, ENABLE);
+}
+
+// the write position is where the dma is going to put the next byte
+static int rxhead(void) {
+	return (UART_RXBUFSIZE - DMA1_Stream5->NDTR) & RXMASK;
+}
+
+int uart_rxpending(void) {
+	return (rxhead() - rxtail) & RXMASK;
+}
+
+// Next received byte or -1 if none
+int uart_getc(void) {
+	int head = rxhead();
+	if (rxtail == head)
+		return -1;
+	int c = rxbuf[rxtail];
+	rxtail = (rxtail + 1) & RXMASK;
+	return c;
+}
+
+void USART2_IRQHandler(void) {
+	// sr read followed by dr read clears idle (and overrun)
+	if (USART2->SR & (USART_SR_IDLE | USART_SR_ORE)) {
+		(void)USART2->DR;
+		uart_rxbursts++;
+	}
+}
+
+/*
+ * Start sending the committed bytes if the dma is idle. A transfer stops at
+ * the end of the buffer; the completion interrupt continues from there.
+ */
+static void tx_kick(void) {
+	for (;;) {
+		if (!cas(&txbusy, 0, 1))
+			return;
+		uint32_t tail = txtail;
+		uint32_t n = txcommitted - tail;
+		if (n) {
+			uint32_t off = tail & TXMASK;
+			if (n > UART_TXBUFSIZE - off)
+				n = UART_TXBUFSIZE - off;
+			txlen = n;
+			DMA1->HIFCR = TXFLAGS6;
+			DMA1_Stream6->M0AR = (uint32_t)&txbuf[off];
+			DMA1_Stream6->NDTR = n;
+			DMA1_Stream6->CR |= DMA_SxCR_EN;
+			return;
+		}
+		txbusy = 0;
+		// something may have been committed while we held txbusy
+		if (txcommitted == txtail)
+			return;
+	}
+}
+
+static void tx_commit(void) {
+	uint32_t r = txreserved, c;
+	do {
+		c = txcommitted;
+		if ((int32_t)(r - c) <= 0)
+			return;
+	} while (!cas(&txcommitted, c, r));
+}
+
+/*
+ * Queue len bytes for sending. All or nothing: when the buffer is full the
+ * whole write is dropped and counted, so that binary records stay whole.
+ */
+int uart_write(const void *data, int len) {
+	const uint8_t *src = data;
+	uint32_t start;
+	int ok = 1;
+
+	__sync_add_and_fetch(&txwriters, 1);
+	do {
+		start = txreserved;
+		if (start + len - txtail > UART_TXBUFSIZE) {
+			ok = 0;
+			break;
+		}
+	} while (!cas(&txreserved, start, start + len));
+
+	if (ok) {
+		for (int i = 0; i < len; i++)
+			txbuf[(start + i) & TXMASK] = src[i];
+	} else {
+		__sync_add_and_fetch(&uart_txdrops, 1);
+	}
+
+	if (__sync_sub_and_fetch(&txwriters, 1) == 0)
+		tx_commit();
+	tx_kick();
+	return ok ? len : 0;
+}
+
+void DMA1_Stream6_IRQHandler(void) {
+	if (DMA1->HISR & DMA_HISR_TCIF6) {
+		DMA1->HIFCR = TXFLAGS6;
+		txtail += txlen;
+		txbusy = 0;
+		tx_kick();
+	}
+}
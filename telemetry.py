@@ -0,0 +1,48 @@
+#!/usr/bin/python
+# Live view of the synth's telemetry records: load, underruns, queue depth
+# and a level bar per voice. Text log lines are kept below.
+# usage: telemetry.py [/dev/ttyUSB0 [baud]]
+import serial, sys
+from logcat import BAUDRATE, records, parse_telemetry, REC_TELEMETRY, NUM_CHANNELS, INSTRUMENTS, ADSR_MODES
+
+BARWIDTH = 40
+LOGLINES = 8
+
+def instrname(i):
+	return INSTRUMENTS[i] if i < len(INSTRUMENTS) else "instr%d" % i
+
+def draw(t, log):
+	out = ["\x1b[H\x1b[2J"]
+	out.append("cpu %5.1f%% avg %5.1f%% peak   underruns %d   midi queue %d   log drops %d" % (
+		t["cpuavg"], t["cpupeak"], t["underruns"], t["rxdepth"], t["txdrops"]))
+	out.append("")
+	live = dict((v[0], v) for v in t["voices"])
+	for ch in range(NUM_CHANNELS):
+		if ch in live:
+			_, ins, note, mode, lvl = live[ch]
+			bar = "#" * int(lvl * BARWIDTH)
+			out.append("%2d %-10s n%3d %s |%-*s| %.2f" % (ch, instrname(ins), note,
+				ADSR_MODES.get(mode, "?"), BARWIDTH, bar, lvl))
+		else:
+			out.append("%2d -" % ch)
+	out.append("")
+	out.extend(log[-LOGLINES:])
+	sys.stdout.write("\n".join(out) + "\n")
+	sys.stdout.flush()
+
+def main(port, baud=BAUDRATE):
+	s = serial.Serial(port, baud)
+	log = [""]
+	for rectype, data in records(s):
+		if rectype is None:
+			if data == "\n":
+				log.append("")
+			elif data != "\r":
+				log[-1] += data
+			del log[:-LOGLINES]
+		elif rectype == REC_TELEMETRY:
+			draw(parse_telemetry(data), log)
+
+if __name__ == "__main__":
+	main(sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyUSB0",
+			int(sys.argv[2]) if len(sys.argv) > 2 else BAUDRATE)